@@ -12,6 +12,11 @@ $BIN write_vk -o vk $FLAGS $BFLAG
 $BIN write_pk -o pk $FLAGS $BFLAG
 $BIN verify -k vk -p proof $FLAGS
 
+# Test we can prove with a memory mapped proving key.
+$BIN write_pk --mmap -o pk_mmap $FLAGS $BFLAG
+$BIN prove --mmap-pk pk_mmap -o proof_mmap $FLAGS $BFLAG
+$BIN verify -k vk -p proof_mmap $FLAGS
+
 # Check supplemental functions.
 # Grep to determine success.
 $BIN contract -k vk $BFLAG -o - | grep "Verification Key Hash" > /dev/null
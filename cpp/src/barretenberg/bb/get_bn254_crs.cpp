@@ -1,5 +1,6 @@
 #include "get_bn254_crs.hpp"
 #include "barretenberg/bb/file_io.hpp"
+#include "barretenberg/srs/factories/mmap_prover_crs.hpp"
 
 std::vector<uint8_t> download_bn254_g1_data(size_t num_points)
 {
@@ -71,3 +72,25 @@ bb::g2::affine_element get_bn254_g2_data(const std::filesystem::path& path)
     write_file(g2_path, data);
     return from_buffer<bb::g2::affine_element>(data.data());
 }
+
+/**
+ * @brief Returns a prover crs of (at least) `num_points` points, backed by a memory-mapped point table cache.
+ *
+ * @details The cache holds the g1 points already in the form the prover uses them, so loading it is O(1) and every bb
+ * process on the host shares one copy of it. If there is no cache, or it is too small, it is (re)built from the g1
+ * data, downloading more points if needed.
+ */
+std::shared_ptr<bb::srs::factories::ProverCrs<curve::BN254>> get_bn254_prover_crs(const std::filesystem::path& path,
+                                                                                 size_t num_points)
+{
+    using MmapProverCrs = bb::srs::factories::MmapProverCrs<curve::BN254>;
+    std::filesystem::create_directories(path);
+
+    auto point_table_path = (path / "bn254_g1_point_table.dat").string();
+    if (MmapProverCrs::get_cache_size(point_table_path) < num_points) {
+        auto points = get_bn254_g1_data(path, num_points);
+        vinfo("writing crs point table cache of size ", std::to_string(points.size()), " to ", point_table_path);
+        MmapProverCrs::write_cache(point_table_path, points.data(), points.size());
+    }
+    return std::make_shared<MmapProverCrs>(point_table_path, num_points);
+}
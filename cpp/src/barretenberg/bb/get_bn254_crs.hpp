@@ -3,10 +3,13 @@
 #include "file_io.hpp"
 #include "log.hpp"
 #include <barretenberg/ecc/curves/bn254/g1.hpp>
+#include <barretenberg/srs/factories/crs_factory.hpp>
 #include <barretenberg/srs/io.hpp>
 #include <filesystem>
 #include <fstream>
 #include <ios>
 
 std::vector<bb::g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path, size_t num_points);
-bb::g2::affine_element get_bn254_g2_data(const std::filesystem::path& path);
\ No newline at end of file
+bb::g2::affine_element get_bn254_g2_data(const std::filesystem::path& path);
+std::shared_ptr<bb::srs::factories::ProverCrs<curve::BN254>> get_bn254_prover_crs(const std::filesystem::path& path,
+                                                                                 size_t num_points);
\ No newline at end of file
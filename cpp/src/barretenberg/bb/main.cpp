@@ -1,10 +1,12 @@
 #include "barretenberg/dsl/types.hpp"
+#include "barretenberg/plonk/proof_system/proving_key/mmap_proving_key.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
 #include "config.hpp"
 #include "get_bn254_crs.hpp"
 #include "get_bytecode.hpp"
 #include "get_grumpkin_crs.hpp"
 #include "log.hpp"
+#include "serve.hpp"
 #include <barretenberg/common/benchmark.hpp>
 #include <barretenberg/common/container.hpp>
 #include <barretenberg/common/timer.hpp>
@@ -38,9 +40,9 @@ const auto current_dir = current_path.filename().string();
 void init_bn254_crs(size_t dyadic_circuit_size)
 {
     // Must +1 for Plonk only!
-    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, dyadic_circuit_size + 1);
+    auto bn254_prover_crs = get_bn254_prover_crs(CRS_PATH, dyadic_circuit_size + 1);
     auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory(bn254_g1_data, bn254_g2_data);
+    srs::init_crs_factory_with_prover_crs(bn254_prover_crs, bn254_g2_data);
 }
 
 void init_grumpkin_crs(size_t eccvm_dyadic_circuit_size)
@@ -163,11 +165,14 @@ bool proveAndVerifyGoblin(const std::string& bytecodePath,
  * @param witnessPath Path to the file containing the serialized witness
  * @param recursive Whether to use recursive proof generation of non-recursive
  * @param outputPath Path to write the proof to
+ * @param mmapPkPath Path to a proving key of the circuit written by `write_pk --mmap`, which is mapped instead of
+ * computing the key. Computes the key if empty.
  */
 void prove(const std::string& bytecodePath,
            const std::string& witnessPath,
            bool recursive,
-           const std::string& outputPath)
+           const std::string& outputPath,
+           const std::string& mmapPkPath)
 {
     auto constraint_system = get_constraint_system(bytecodePath);
     auto witness = get_witness(witnessPath);
@@ -175,7 +180,12 @@ void prove(const std::string& bytecodePath,
     acir_proofs::AcirComposer acir_composer{ 0, verbose };
     acir_composer.create_circuit(constraint_system, witness);
     init_bn254_crs(acir_composer.get_dyadic_circuit_size());
-    acir_composer.init_proving_key();
+    if (mmapPkPath.empty()) {
+        acir_composer.init_proving_key();
+    } else {
+        acir_composer.load_proving_key(plonk::read_mmap_proving_key(mmapPkPath));
+        vinfo("mapped pk from: ", mmapPkPath);
+    }
     auto proof = acir_composer.create_proof(recursive);
 
     if (outputPath == "-") {
@@ -261,13 +271,21 @@ void write_vk(const std::string& bytecodePath, const std::string& outputPath)
     }
 }
 
-void write_pk(const std::string& bytecodePath, const std::string& outputPath)
+void write_pk(const std::string& bytecodePath, const std::string& outputPath, bool mmap_format)
 {
     auto constraint_system = get_constraint_system(bytecodePath);
     acir_proofs::AcirComposer acir_composer{ 0, verbose };
     acir_composer.create_circuit(constraint_system);
     init_bn254_crs(acir_composer.get_dyadic_circuit_size());
     auto pk = acir_composer.init_proving_key();
+    if (mmap_format) {
+        if (outputPath == "-") {
+            throw std::runtime_error("A memory mappable pk can only be written to a file.");
+        }
+        plonk::write_mmap_proving_key(outputPath, *pk);
+        vinfo("memory mappable pk written to: ", outputPath);
+        return;
+    }
     auto serialized_pk = to_buffer(*pk);
 
     if (outputPath == "-") {
@@ -455,6 +473,12 @@ int main(int argc, char* argv[])
             acvm_info(output_path);
             return 0;
         }
+        if (command == "serve") {
+            return serve(CRS_PATH,
+                         get_option(args, "--socket", ""),
+                         std::stoul(get_option(args, "--jobs", "4")),
+                         std::stoul(get_option(args, "--max-circuits", "16")));
+        }
         if (command == "prove_and_verify") {
             return proveAndVerify(bytecode_path, witness_path, recursive) ? 0 : 1;
         }
@@ -463,7 +487,7 @@ int main(int argc, char* argv[])
         }
         if (command == "prove") {
             std::string output_path = get_option(args, "-o", "./proofs/proof");
-            prove(bytecode_path, witness_path, recursive, output_path);
+            prove(bytecode_path, witness_path, recursive, output_path, get_option(args, "--mmap-pk", ""));
         } else if (command == "gates") {
             gateCount(bytecode_path);
         } else if (command == "verify") {
@@ -476,7 +500,7 @@ int main(int argc, char* argv[])
             write_vk(bytecode_path, output_path);
         } else if (command == "write_pk") {
             std::string output_path = get_option(args, "-o", "./target/pk");
-            write_pk(bytecode_path, output_path);
+            write_pk(bytecode_path, output_path, flag_present(args, "--mmap"));
         } else if (command == "proof_as_fields") {
             std::string output_path = get_option(args, "-o", proof_path + "_fields.json");
             proof_as_fields(proof_path, vk_path, output_path);
@@ -0,0 +1,378 @@
+#include "serve.hpp"
+#include "get_bn254_crs.hpp"
+#include "log.hpp"
+#include <barretenberg/crypto/sha256/sha256.hpp>
+#include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
+#include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
+#include <barretenberg/plonk/proof_system/verification_key/verification_key.hpp>
+#include <barretenberg/serialize/cbind.hpp>
+#include <barretenberg/srs/global_crs.hpp>
+
+#include <condition_variable>
+#include <csignal>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace bb;
+
+namespace {
+
+/**
+ * @brief A circuit seen by the server, with the keys computed for it
+ */
+struct CachedCircuit {
+    // Jobs on a circuit run one at a time, as a proof writes its witness into the proving key of the circuit
+    std::mutex mutex;
+    acir_format::acir_format constraint_system;
+    acir_proofs::AcirComposer composer{ 0, false };
+    bool has_proving_key = false;
+    std::vector<uint8_t> serialized_vk;
+    uint64_t last_used = 0;
+};
+
+/**
+ * @brief An input and output pair of file descriptors that requests are read from and responses written to
+ */
+struct Connection {
+    Connection(int input_fd, int output_fd, bool owns_fds)
+        : input_fd(input_fd)
+        , output_fd(output_fd)
+        , owns_fds(owns_fds)
+    {}
+    Connection(const Connection& other) = delete;
+    Connection(Connection&& other) = delete;
+    Connection& operator=(const Connection& other) = delete;
+    Connection& operator=(Connection&& other) = delete;
+    ~Connection()
+    {
+        if (owns_fds) {
+            close(input_fd);
+        }
+    }
+
+    bool read_frame(std::vector<uint8_t>& frame) const
+    {
+        std::array<uint8_t, 4> size_bytes{};
+        if (!read_bytes(size_bytes.data(), size_bytes.size())) {
+            return false;
+        }
+        const uint32_t size = (static_cast<uint32_t>(size_bytes[0]) << 24) |
+                              (static_cast<uint32_t>(size_bytes[1]) << 16) |
+                              (static_cast<uint32_t>(size_bytes[2]) << 8) | static_cast<uint32_t>(size_bytes[3]);
+        frame.resize(size);
+        return read_bytes(frame.data(), frame.size());
+    }
+
+    // Responses of concurrent jobs are written whole, one after the other
+    void write_frame(const msgpack::sbuffer& buffer)
+    {
+        const auto size = static_cast<uint32_t>(buffer.size());
+        const std::array<uint8_t, 4> size_bytes{ static_cast<uint8_t>(size >> 24),
+                                                 static_cast<uint8_t>(size >> 16),
+                                                 static_cast<uint8_t>(size >> 8),
+                                                 static_cast<uint8_t>(size) };
+        std::lock_guard<std::mutex> lock(write_mutex);
+        write_bytes(size_bytes.data(), size_bytes.size());
+        write_bytes(reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size());
+    }
+
+  private:
+    bool read_bytes(uint8_t* data, size_t size) const
+    {
+        while (size > 0) {
+            const ssize_t num_read = read(input_fd, data, size);
+            if (num_read <= 0) {
+                return false;
+            }
+            data += num_read;
+            size -= static_cast<size_t>(num_read);
+        }
+        return true;
+    }
+
+    void write_bytes(const uint8_t* data, size_t size) const
+    {
+        while (size > 0) {
+            const ssize_t num_written = write(output_fd, data, size);
+            if (num_written <= 0) {
+                // the client went away, its pending responses are dropped
+                return;
+            }
+            data += num_written;
+            size -= static_cast<size_t>(num_written);
+        }
+    }
+
+    int input_fd;
+    int output_fd;
+    bool owns_fds;
+    std::mutex write_mutex;
+};
+
+class Server {
+  public:
+    Server(std::string crs_path, size_t max_concurrent_jobs, size_t max_cached_circuits)
+        : crs_path(std::move(crs_path))
+        , max_concurrent_jobs(std::max(max_concurrent_jobs, size_t(1)))
+        , max_cached_circuits(std::max(max_cached_circuits, size_t(1)))
+    {
+        // The verifier only needs the G2 point, G1 points are loaded as circuits come in
+        g2_point = get_bn254_g2_data(this->crs_path);
+        srs::init_crs_factory({}, g2_point);
+    }
+
+    /**
+     * @brief Reads requests from a connection until it is closed, processing them concurrently
+     */
+    void serve_connection(const std::shared_ptr<Connection>& connection)
+    {
+        std::vector<uint8_t> frame;
+        while (connection->read_frame(frame)) {
+            ServeRequest request;
+            try {
+                msgpack::unpack(reinterpret_cast<const char*>(frame.data()), frame.size()).get().convert(request);
+            } catch (std::exception const& err) {
+                ServeResponse response;
+                response.error = err.what();
+                respond(*connection, response);
+                continue;
+            }
+            // Blocks while max_concurrent_jobs are running, which throttles the client
+            std::unique_lock<std::mutex> lock(jobs_mutex);
+            jobs_done.wait(lock, [&] { return num_running_jobs < max_concurrent_jobs; });
+            ++num_running_jobs;
+            lock.unlock();
+            std::thread([this, connection, request = std::move(request)]() mutable {
+                respond(*connection, process(request));
+                std::lock_guard<std::mutex> lock(jobs_mutex);
+                --num_running_jobs;
+                jobs_done.notify_all();
+            }).detach();
+        }
+    }
+
+    void wait_for_jobs()
+    {
+        std::unique_lock<std::mutex> lock(jobs_mutex);
+        jobs_done.wait(lock, [&] { return num_running_jobs == 0; });
+    }
+
+  private:
+    static void respond(Connection& connection, ServeResponse const& response)
+    {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, response);
+        connection.write_frame(buffer);
+    }
+
+    ServeResponse process(ServeRequest& request)
+    {
+        ServeResponse response;
+        response.id = request.id;
+        try {
+            if (request.command == "prove") {
+                auto circuit = get_circuit(request.bytecode);
+                std::lock_guard<std::mutex> lock(circuit->mutex);
+                response.result = prove(*circuit, request);
+            } else if (request.command == "prove_and_verify") {
+                auto circuit = get_circuit(request.bytecode);
+                std::lock_guard<std::mutex> lock(circuit->mutex);
+                response.result = prove(*circuit, request);
+                init_verification_key(*circuit);
+                response.verified = circuit->composer.verify_proof(response.result, request.recursive);
+            } else if (request.command == "write_vk") {
+                auto circuit = get_circuit(request.bytecode);
+                std::lock_guard<std::mutex> lock(circuit->mutex);
+                response.result = init_verification_key(*circuit);
+            } else if (request.command == "verify") {
+                response.verified = verify(request);
+            } else {
+                throw std::runtime_error("Unknown command: " + request.command);
+            }
+            response.success = true;
+        } catch (std::exception const& err) {
+            response.success = false;
+            response.error = err.what();
+            response.result.clear();
+        }
+        return response;
+    }
+
+    /**
+     * @brief Get the cached circuit of some bytecode, parsing it if it was not seen before
+     */
+    std::shared_ptr<CachedCircuit> get_circuit(std::vector<uint8_t> const& bytecode)
+    {
+        const auto hash = sha256::sha256(bytecode);
+        {
+            std::lock_guard<std::mutex> lock(circuits_mutex);
+            auto it = circuits.find(hash);
+            if (it != circuits.end()) {
+                it->second->last_used = ++use_counter;
+                return it->second;
+            }
+        }
+        auto circuit = std::make_shared<CachedCircuit>();
+        circuit->constraint_system = acir_format::circuit_buf_to_acir_format(bytecode);
+
+        std::lock_guard<std::mutex> lock(circuits_mutex);
+        // Another job may have parsed the same circuit meanwhile, keep the first one so keys are computed once
+        auto [it, inserted] = circuits.emplace(hash, circuit);
+        it->second->last_used = ++use_counter;
+        if (inserted && circuits.size() > max_cached_circuits) {
+            evict_least_recently_used(hash);
+        }
+        return it->second;
+    }
+
+    // Drops the least recently used circuit other than `keep`. Jobs running on it keep their reference.
+    void evict_least_recently_used(const sha256::hash& keep)
+    {
+        auto oldest = circuits.end();
+        for (auto it = circuits.begin(); it != circuits.end(); ++it) {
+            if (it->first != keep && (oldest == circuits.end() || it->second->last_used < oldest->second->last_used)) {
+                oldest = it;
+            }
+        }
+        if (oldest != circuits.end()) {
+            circuits.erase(oldest);
+        }
+    }
+
+    // Must be called holding the mutex of the circuit
+    std::vector<uint8_t> prove(CachedCircuit& circuit, ServeRequest const& request)
+    {
+        // Witness generation and circuit construction run concurrently with other jobs
+        auto witness = acir_format::witness_buf_to_witness_data(request.witness);
+        circuit.composer.create_circuit(circuit.constraint_system, witness);
+
+        // The provers use all cores and share process wide scratch buffers, so proofs are constructed one at a time
+        std::lock_guard<std::mutex> lock(prover_mutex);
+        init_proving_key(circuit);
+        return circuit.composer.create_proof(request.recursive);
+    }
+
+    // Must be called holding the mutex of the circuit and the prover mutex
+    void init_proving_key(CachedCircuit& circuit)
+    {
+        if (circuit.has_proving_key) {
+            return;
+        }
+        grow_crs(circuit.composer.get_dyadic_circuit_size());
+        circuit.composer.init_proving_key();
+        circuit.has_proving_key = true;
+    }
+
+    // Must be called holding the mutex of the circuit
+    std::vector<uint8_t> const& init_verification_key(CachedCircuit& circuit)
+    {
+        if (circuit.serialized_vk.empty()) {
+            std::lock_guard<std::mutex> lock(prover_mutex);
+            if (!circuit.has_proving_key) {
+                circuit.composer.create_circuit(circuit.constraint_system);
+            }
+            init_proving_key(circuit);
+            circuit.serialized_vk = to_buffer(*circuit.composer.init_verification_key());
+        }
+        return circuit.serialized_vk;
+    }
+
+    bool verify(ServeRequest const& request)
+    {
+        if (request.vk.empty()) {
+            auto circuit = get_circuit(request.bytecode);
+            std::lock_guard<std::mutex> lock(circuit->mutex);
+            init_verification_key(*circuit);
+            return circuit->composer.verify_proof(request.proof, request.recursive);
+        }
+        acir_proofs::AcirComposer composer{ 0, false };
+        {
+            // Loading a key reads the global CRS, which grow_crs replaces
+            std::lock_guard<std::mutex> lock(crs_mutex);
+            composer.load_verification_key(from_buffer<plonk::verification_key_data>(request.vk));
+        }
+        return composer.verify_proof(request.proof, request.recursive);
+    }
+
+    // Must be called holding the prover mutex. Keys computed before keep the CRS they were computed with.
+    void grow_crs(size_t dyadic_circuit_size)
+    {
+        // Must +1 for Plonk only!
+        const size_t num_points = dyadic_circuit_size + 1;
+        if (num_points <= crs_size) {
+            return;
+        }
+        auto prover_crs = get_bn254_prover_crs(crs_path, num_points);
+        std::lock_guard<std::mutex> lock(crs_mutex);
+        srs::init_crs_factory_with_prover_crs(prover_crs, g2_point);
+        crs_size = num_points;
+    }
+
+    std::string crs_path;
+    size_t max_concurrent_jobs;
+    size_t max_cached_circuits;
+
+    bb::g2::affine_element g2_point;
+    size_t crs_size = 0;
+    std::mutex crs_mutex;
+    std::mutex prover_mutex;
+
+    std::map<sha256::hash, std::shared_ptr<CachedCircuit>> circuits;
+    uint64_t use_counter = 0;
+    std::mutex circuits_mutex;
+
+    size_t num_running_jobs = 0;
+    std::mutex jobs_mutex;
+    std::condition_variable jobs_done;
+};
+
+} // namespace
+
+int serve(const std::string& crs_path,
+          const std::string& socket_path,
+          size_t max_concurrent_jobs,
+          size_t max_cached_circuits)
+{
+    // Writing to a client that went away must not kill the server
+    std::signal(SIGPIPE, SIG_IGN);
+    Server server(crs_path, max_concurrent_jobs, max_cached_circuits);
+
+    if (socket_path.empty()) {
+        vinfo("serving requests on stdin");
+        server.serve_connection(std::make_shared<Connection>(STDIN_FILENO, STDOUT_FILENO, false));
+        server.wait_for_jobs();
+        return 0;
+    }
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        throw std::runtime_error("Socket path is too long: " + socket_path);
+    }
+    std::copy(socket_path.begin(), socket_path.end(), address.sun_path);
+    const int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        throw std::runtime_error("Failed to create socket.");
+    }
+    unlink(socket_path.c_str());
+    if (bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listen_fd, 16) != 0) {
+        close(listen_fd);
+        throw std::runtime_error("Failed to listen on socket: " + socket_path);
+    }
+    vinfo("serving requests on ", socket_path);
+    while (true) {
+        const int fd = accept(listen_fd, nullptr, nullptr);
+        if (fd < 0) {
+            continue;
+        }
+        std::thread([&server, fd]() { server.serve_connection(std::make_shared<Connection>(fd, fd, true)); })
+            .detach();
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <barretenberg/serialize/msgpack.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief A request to a `bb serve` process
+ *
+ * @details Requests and responses are msgpack maps, each preceded by its size as a 4 byte big endian integer.
+ *
+ * `command` is one of:
+ * - prove: proves `bytecode` with `witness`, the proof is returned in `result`
+ * - verify: verifies `proof` against `vk`, or against the verification key of `bytecode` if no vk is given
+ * - write_vk: returns the serialized verification key of `bytecode` in `result`
+ * - prove_and_verify: proves then verifies, the proof is returned in `result`
+ *
+ * `bytecode` and `witness` are the uncompressed ACIR circuit and witness buffers. The `id` of a request is echoed in
+ * its response, as requests are processed concurrently and responses are sent as soon as they are ready.
+ */
+struct ServeRequest {
+    uint64_t id = 0;
+    std::string command;
+    std::vector<uint8_t> bytecode;
+    std::vector<uint8_t> witness;
+    std::vector<uint8_t> proof;
+    std::vector<uint8_t> vk;
+    bool recursive = false;
+
+    MSGPACK_FIELDS(id, command, bytecode, witness, proof, vk, recursive);
+};
+
+struct ServeResponse {
+    uint64_t id = 0;
+    bool success = false;
+    // set when success is false
+    std::string error;
+    std::vector<uint8_t> result;
+    bool verified = false;
+
+    MSGPACK_FIELDS(id, success, error, result, verified);
+};
+
+/**
+ * @brief Serves proving and verification requests until the input is closed
+ *
+ * @details The CRS, the parsed circuits and their proving and verification keys are kept across requests, circuits
+ * being identified by the hash of their bytecode. Up to `max_concurrent_jobs` requests are processed at a time.
+ *
+ * @param crs_path Directory of the CRS, grown on demand as larger circuits are seen
+ * @param socket_path Unix domain socket to listen on, requests are read from stdin and responses written to stdout if
+ * empty
+ * @param max_concurrent_jobs Number of requests processed at the same time
+ * @param max_cached_circuits Number of circuits whose keys are kept, the least recently used ones are dropped first
+ * @return int The exit code
+ */
+int serve(const std::string& crs_path,
+          const std::string& socket_path,
+          size_t max_concurrent_jobs,
+          size_t max_cached_circuits);
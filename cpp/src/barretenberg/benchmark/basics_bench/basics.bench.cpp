@@ -139,6 +139,79 @@ void ff_sqr(State& state)
     }
 }
 
+/**
+ * @brief Evaluate the per-element cost of multiplying two vectors of field elements one element at a time, as a
+ * baseline for ff_multiplication_batch
+ *
+ * @param state
+ */
+void ff_multiplication_vector(State& state)
+{
+    numeric::random::Engine& engine = numeric::random::get_debug_engine();
+    size_t num_elements = 1 << static_cast<size_t>(state.range(0));
+    std::vector<Fr> a(num_elements);
+    std::vector<Fr> b(num_elements);
+    std::vector<Fr> result(num_elements);
+    for (size_t i = 0; i < num_elements; i++) {
+        a[i] = Fr::random_element(&engine);
+        b[i] = Fr::random_element(&engine);
+    }
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_elements; i++) {
+            result[i] = a[i] * b[i];
+        }
+        DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_elements));
+}
+
+/**
+ * @brief Evaluate the per-element cost of Fr::mul_batch, which uses the multi-lane kernels when the CPU supports them
+ *
+ * @param state
+ */
+void ff_multiplication_batch(State& state)
+{
+    numeric::random::Engine& engine = numeric::random::get_debug_engine();
+    size_t num_elements = 1 << static_cast<size_t>(state.range(0));
+    std::vector<Fr> a(num_elements);
+    std::vector<Fr> b(num_elements);
+    std::vector<Fr> result(num_elements);
+    for (size_t i = 0; i < num_elements; i++) {
+        a[i] = Fr::random_element(&engine);
+        b[i] = Fr::random_element(&engine);
+    }
+
+    for (auto _ : state) {
+        Fr::mul_batch(a, b, result);
+        DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_elements));
+}
+
+/**
+ * @brief Evaluate the per-element cost of Fr::sqr_batch
+ *
+ * @param state
+ */
+void ff_sqr_batch(State& state)
+{
+    numeric::random::Engine& engine = numeric::random::get_debug_engine();
+    size_t num_elements = 1 << static_cast<size_t>(state.range(0));
+    std::vector<Fr> a(num_elements);
+    std::vector<Fr> result(num_elements);
+    for (auto& element : a) {
+        element = Fr::random_element(&engine);
+    }
+
+    for (auto _ : state) {
+        Fr::sqr_batch(a, result);
+        DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_elements));
+}
+
 /**
  * @brief Evaluate how much finite field inversion costs (in cache)
  *
@@ -369,6 +442,9 @@ BENCHMARK(parallel_for_field_element_addition)->Unit(kMicrosecond)->DenseRange(0
 BENCHMARK(ff_addition)->Unit(kMicrosecond)->DenseRange(12, 30);
 BENCHMARK(ff_multiplication)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_sqr)->Unit(kMicrosecond)->DenseRange(12, 27);
+BENCHMARK(ff_multiplication_vector)->Unit(kMicrosecond)->DenseRange(12, 20);
+BENCHMARK(ff_multiplication_batch)->Unit(kMicrosecond)->DenseRange(12, 20);
+BENCHMARK(ff_sqr_batch)->Unit(kMicrosecond)->DenseRange(12, 20);
 BENCHMARK(ff_invert)->Unit(kMicrosecond)->DenseRange(12, 19);
 BENCHMARK(ff_to_montgomery)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_from_montgomery)->Unit(kMicrosecond)->DenseRange(12, 27);
@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/crypto/generators/fixed_base_table.hpp"
+#include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
+#include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+using Curve = curve::Grumpkin;
+using Element = Curve::Element;
+using Fq = Curve::BaseField;
+using Fr = Curve::ScalarField;
+
+/**
+ * @brief Benchmark: Native pedersen hash of two field elements, as used to compute merkle tree nodes
+ */
+void pedersen_hash_native(State& state) noexcept
+{
+    Fq left = Fq::random_element();
+    const Fq right = Fq::random_element();
+    for (auto _ : state) {
+        left = crypto::pedersen_hash::hash({ left, right });
+        DoNotOptimize(left);
+    }
+}
+
+/**
+ * @brief Benchmark: The same hash computed with variable base scalar multiplications, for comparison
+ */
+void pedersen_hash_variable_base(State& state) noexcept
+{
+    const auto generators = crypto::pedersen_hash::GeneratorContext().generators->get(2);
+    const auto length_generator = crypto::pedersen_hash::length_generator;
+    Fq left = Fq::random_element();
+    const Fq right = Fq::random_element();
+    for (auto _ : state) {
+        Element result = Element(length_generator) * Fr(2);
+        result += Element(generators[0]) * static_cast<uint256_t>(left);
+        result += Element(generators[1]) * static_cast<uint256_t>(right);
+        left = result.normalize().x;
+        DoNotOptimize(left);
+    }
+}
+
+std::vector<std::array<Fq, 2>> random_pairs(const size_t num_pairs)
+{
+    std::vector<std::array<Fq, 2>> pairs(num_pairs);
+    for (auto& pair : pairs) {
+        pair = { Fq::random_element(), Fq::random_element() };
+    }
+    return pairs;
+}
+
+/**
+ * @brief Benchmark: Hashing a merkle tree layer of state.range(0) pairs one hash at a time
+ */
+void pedersen_hash_layer(State& state) noexcept
+{
+    const auto pairs = random_pairs(static_cast<size_t>(state.range(0)));
+    std::vector<Fq> results(pairs.size());
+    for (auto _ : state) {
+        for (size_t i = 0; i < pairs.size(); ++i) {
+            results[i] = crypto::pedersen_hash::hash({ pairs[i][0], pairs[i][1] });
+        }
+        DoNotOptimize(results);
+    }
+}
+
+/**
+ * @brief Benchmark: Hashing a merkle tree layer of state.range(0) pairs with hash_batch
+ */
+void pedersen_hash_batch(State& state) noexcept
+{
+    const auto pairs = random_pairs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(crypto::pedersen_hash::hash_batch(pairs));
+    }
+}
+
+/**
+ * @brief Benchmark: Native pedersen commitment to state.range(0) field elements
+ */
+void pedersen_commit_native(State& state) noexcept
+{
+    std::vector<Fq> inputs(static_cast<size_t>(state.range(0)));
+    for (auto& input : inputs) {
+        input = Fq::random_element();
+    }
+    for (auto _ : state) {
+        DoNotOptimize(crypto::pedersen_commitment::commit_native(inputs));
+    }
+}
+
+/**
+ * @brief Benchmark: Construction of the table of one generator, paid the first time the generator is used
+ */
+void fixed_base_table_construction(State& state) noexcept
+{
+    const auto generator = crypto::pedersen_hash::length_generator;
+    for (auto _ : state) {
+        crypto::fixed_base_table<Curve> table(generator);
+        DoNotOptimize(table);
+    }
+}
+
+} // namespace
+
+BENCHMARK(pedersen_hash_native)->Unit(kMicrosecond);
+BENCHMARK(pedersen_hash_variable_base)->Unit(kMicrosecond);
+BENCHMARK(pedersen_hash_layer)->RangeMultiplier(16)->Range(1 << 8, 1 << 16)->Unit(kMillisecond);
+BENCHMARK(pedersen_hash_batch)->RangeMultiplier(16)->Range(1 << 8, 1 << 16)->Unit(kMillisecond);
+BENCHMARK(pedersen_commit_native)->Arg(2)->Arg(8)->Arg(32)->Unit(kMicrosecond);
+BENCHMARK(fixed_base_table_construction)->Unit(kMicrosecond);
+
+BENCHMARK_MAIN();
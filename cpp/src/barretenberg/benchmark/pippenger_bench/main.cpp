@@ -81,6 +81,21 @@ int pippenger()
     return 0;
 }
 
+int pippenger_fixed_base()
+{
+    static const auto table = reference_string->get_fixed_base_point_table(
+        scalar_multiplication::fixed_base_point_table<curve::BN254>::DEFAULT_MAX_TABLE_BYTES);
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(NUM_POINTS);
+    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+    g1::element result =
+        scalar_multiplication::pippenger_fixed_base_unsafe<curve::BN254>(&scalars[0], *table, NUM_POINTS, state);
+    std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+    std::chrono::microseconds diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
+    std::cout << "run time: " << diff.count() << "us" << std::endl;
+    std::cout << result.x << std::endl;
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -116,5 +131,11 @@ int main()
     pippenger();
     pippenger();
     pippenger();
+    std::cout << "executing fixed-base pippenger algorithm" << std::endl;
+    pippenger_fixed_base();
+    pippenger_fixed_base();
+    pippenger_fixed_base();
+    pippenger_fixed_base();
+    pippenger_fixed_base();
     return 0;
 }
@@ -9,12 +9,10 @@ using namespace benchmark;
 namespace bb::honk {
 using Flavor = flavor::Ultra;
 using Instance = ProverInstance_<Flavor>;
-using Instances = ProverInstances_<Flavor, 2>;
-using ProtoGalaxyProver = ProtoGalaxyProver_<Instances>;
 using Builder = Flavor::CircuitBuilder;
 
-// Fold one instance into an accumulator.
-void fold_one(State& state) noexcept
+// Fold NUM_INSTANCES - 1 instances into an accumulator in a single round.
+template <size_t NUM_INSTANCES> void fold(State& state) noexcept
 {
     bb::srs::init_crs_factory("../srs_db/ignition");
 
@@ -27,15 +25,30 @@ void fold_one(State& state) noexcept
         return composer.create_instance(builder);
     };
 
-    std::shared_ptr<Instance> instance_1 = construct_instance();
-    std::shared_ptr<Instance> instance_2 = construct_instance();
+    std::vector<std::shared_ptr<Instance>> instances;
+    for (size_t idx = 0; idx < NUM_INSTANCES; idx++) {
+        instances.emplace_back(construct_instance());
+    }
 
-    auto folding_prover = composer.create_folding_prover({ instance_1, instance_2 }, composer.commitment_key);
+    auto folding_prover = composer.create_folding_prover<NUM_INSTANCES>(instances, composer.commitment_key);
 
     for (auto _ : state) {
         auto proof = folding_prover.fold_instances();
     }
+
+    // Report the time spent per folded instance, to compare the throughput of the fold arities
+    state.counters["time_per_instance"] =
+        Counter(static_cast<double>(NUM_INSTANCES - 1), Counter::kIsIterationInvariantRate | Counter::kInvert);
+}
+
+// Fold one instance into an accumulator.
+void fold_one(State& state) noexcept
+{
+    fold<2>(state);
 }
 
 BENCHMARK(fold_one)->/* vary the circuit size */ DenseRange(14, 20)->Unit(kMillisecond);
-} // namespace bb::honk
\ No newline at end of file
+BENCHMARK_TEMPLATE(fold, 4)->/* vary the circuit size */ DenseRange(14, 16)->Unit(kMillisecond);
+BENCHMARK_TEMPLATE(fold, 8)->/* vary the circuit size */ DenseRange(14, 16)->Unit(kMillisecond);
+BENCHMARK_TEMPLATE(fold, 16)->/* vary the circuit size */ DenseRange(14, 16)->Unit(kMillisecond);
+} // namespace bb::honk
@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/benchmark/ultra_bench/benchmark_utilities.hpp"
+#include "barretenberg/plonk/composer/ultra_composer.hpp"
+#include "barretenberg/ultra_honk/ultra_composer.hpp"
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+constexpr size_t LOG2_NUM_GATES = 12;
+
+/**
+ * @brief Proofs of one circuit with different witnesses, and a verifier for them
+ */
+template <typename Verifier> struct ProofBatch {
+    Verifier verifier;
+    std::vector<plonk::proof> proofs;
+};
+
+ProofBatch<plonk::UltraVerifier> construct_ultraplonk_proofs(size_t num_proofs)
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    std::vector<plonk::proof> proofs;
+    plonk::UltraVerifier verifier;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        UltraCircuitBuilder builder;
+        bench_utils::generate_basic_arithmetic_circuit(builder, LOG2_NUM_GATES);
+        plonk::UltraComposer composer;
+        auto prover = composer.create_prover(builder);
+        if (i == 0) {
+            verifier = composer.create_verifier(builder);
+        }
+        proofs.emplace_back(prover.construct_proof());
+    }
+    return { std::move(verifier), std::move(proofs) };
+}
+
+ProofBatch<honk::UltraVerifier> construct_ultrahonk_proofs(size_t num_proofs)
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    std::vector<plonk::proof> proofs;
+    std::shared_ptr<honk::UltraComposer::VerificationKey> verification_key;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        UltraCircuitBuilder builder;
+        bench_utils::generate_basic_arithmetic_circuit(builder, LOG2_NUM_GATES);
+        honk::UltraComposer composer;
+        auto instance = composer.create_instance(builder);
+        if (i == 0) {
+            verification_key = composer.create_verifier(instance).key;
+        }
+        proofs.emplace_back(composer.create_prover(instance).construct_proof());
+    }
+    return { honk::UltraVerifier(verification_key), std::move(proofs) };
+}
+
+/**
+ * @brief Benchmark: Verification of state.range(0) proofs one at a time. The per_proof counter is the amortized time
+ * of a verification.
+ */
+template <typename Verifier>
+void verify_individually(State& state, ProofBatch<Verifier> (*construct_proofs)(size_t)) noexcept
+{
+    const auto num_proofs = static_cast<size_t>(state.range(0));
+    auto batch = construct_proofs(num_proofs);
+    for (auto _ : state) {
+        for (const auto& proof : batch.proofs) {
+            DoNotOptimize(batch.verifier.verify_proof(proof));
+        }
+    }
+    state.counters["per_proof"] =
+        Counter(static_cast<double>(num_proofs), Counter::kIsIterationInvariantRate | Counter::kInvert);
+}
+
+/**
+ * @brief Benchmark: Verification of state.range(0) proofs with verify_batch
+ */
+template <typename Verifier>
+void verify_batch(State& state, ProofBatch<Verifier> (*construct_proofs)(size_t)) noexcept
+{
+    const auto num_proofs = static_cast<size_t>(state.range(0));
+    auto batch = construct_proofs(num_proofs);
+    for (auto _ : state) {
+        DoNotOptimize(batch.verifier.verify_batch(batch.proofs));
+    }
+    state.counters["per_proof"] =
+        Counter(static_cast<double>(num_proofs), Counter::kIsIterationInvariantRate | Counter::kInvert);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(verify_individually, ultraplonk, &construct_ultraplonk_proofs)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Unit(kMillisecond);
+BENCHMARK_CAPTURE(verify_batch, ultraplonk, &construct_ultraplonk_proofs)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Unit(kMillisecond);
+BENCHMARK_CAPTURE(verify_individually, ultrahonk, &construct_ultrahonk_proofs)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Unit(kMillisecond);
+BENCHMARK_CAPTURE(verify_batch, ultrahonk, &construct_ultrahonk_proofs)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Unit(kMillisecond);
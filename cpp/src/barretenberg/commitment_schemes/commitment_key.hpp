@@ -18,6 +18,7 @@
 #include <cstddef>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 namespace bb::honk::pcs {
 
@@ -66,12 +67,95 @@ template <class Curve> class CommitmentKey {
     {
         const size_t degree = polynomial.size();
         ASSERT(degree <= srs->get_monomial_size());
+        if (fixed_base_point_table) {
+            return bb::scalar_multiplication::pippenger_fixed_base_unsafe<Curve>(
+                const_cast<Fr*>(polynomial.data()), *fixed_base_point_table, degree, pippenger_runtime_state);
+        }
         return bb::scalar_multiplication::pippenger_unsafe<Curve>(
             const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
     };
 
+    /**
+     * @brief Uses the ProverSRS to create a commitment to p(X), skipping the zero coefficients of p(X)
+     *
+     * @details Costs one scan of the coefficients more than `commit` for dense polynomials, but for polynomials that
+     * are mostly zero (selectors, ecc op wires, databus columns...) the MSM only runs over the non-zero terms. See
+     * bb::scalar_multiplication::pippenger_sparse.
+     *
+     * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
+     * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
+     */
+    Commitment commit_sparse(std::span<const Fr> polynomial)
+    {
+        const size_t degree = polynomial.size();
+        ASSERT(degree <= srs->get_monomial_size());
+        return bb::scalar_multiplication::pippenger_sparse_unsafe<Curve>(
+            const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
+    };
+
+    /**
+     * @brief Uses the ProverSRS to create commitments to several polynomials at once
+     *
+     * @details Polynomials of the same size are committed to with one batched pippenger, which walks the SRS in
+     * chunks and buckets every polynomial of the batch against a chunk before moving on to the next one, so the SRS
+     * points are read once per chunk for the whole batch (see bb::scalar_multiplication::pippenger_batch). The batch
+     * allocates a point schedule per polynomial for the current chunk.
+     *
+     * @param polynomials univariate polynomials pₖ(X) = ∑ᵢ aₖᵢ⋅Xⁱ
+     * @return Commitments Cₖ = [pₖ(x)], in the order of the input polynomials
+     */
+    std::vector<Commitment> commit_batch(std::span<const std::span<const Fr>> polynomials)
+    {
+        std::vector<Commitment> commitments(polynomials.size());
+        if (fixed_base_point_table) {
+            for (size_t i = 0; i < polynomials.size(); ++i) {
+                commitments[i] = commit(polynomials[i]);
+            }
+            return commitments;
+        }
+
+        std::vector<bool> committed(polynomials.size(), false);
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            if (committed[i]) {
+                continue;
+            }
+            const size_t degree = polynomials[i].size();
+            ASSERT(degree <= srs->get_monomial_size());
+            std::vector<size_t> batch_indices;
+            std::vector<const Fr*> batch_scalars;
+            for (size_t j = i; j < polynomials.size(); ++j) {
+                if (!committed[j] && polynomials[j].size() == degree) {
+                    batch_indices.emplace_back(j);
+                    batch_scalars.emplace_back(polynomials[j].data());
+                    committed[j] = true;
+                }
+            }
+            const auto batch_commitments = bb::scalar_multiplication::pippenger_batch_unsafe<Curve>(
+                batch_scalars, srs->get_monomial_points(), degree, pippenger_runtime_state);
+            for (size_t j = 0; j < batch_indices.size(); ++j) {
+                commitments[batch_indices[j]] = batch_commitments[j];
+            }
+        }
+        return commitments;
+    }
+
+    /**
+     * @brief Compute commitments with a fixed-base MSM, over precomputed multiples of the SRS points
+     *
+     * @details The multiples are cached on the ProverCrs, so they are only computed once per SRS and shared by every
+     * CommitmentKey using it. See bb::scalar_multiplication::fixed_base_point_table.
+     *
+     * @param max_table_bytes memory budget for the precomputed multiples
+     */
+    void enable_fixed_base_msm(
+        size_t max_table_bytes = bb::scalar_multiplication::fixed_base_point_table<Curve>::DEFAULT_MAX_TABLE_BYTES)
+    {
+        fixed_base_point_table = srs->get_fixed_base_point_table(max_table_bytes);
+    }
+
     bb::scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> srs;
+    std::shared_ptr<bb::scalar_multiplication::fixed_base_point_table<Curve>> fixed_base_point_table;
 };
 
 } // namespace bb::honk::pcs
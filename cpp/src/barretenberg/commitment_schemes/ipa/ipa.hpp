@@ -70,6 +70,12 @@ template <typename Curve> class IPA {
             /*scalar_multiplications_per_iteration=*/0,
             /*sequential_copy_ops_per_iteration=*/1);
 
+        // The pippenger point table (point and endomorphism pairs) of the current G_vec. In the first round it is the
+        // SRS itself; afterwards it is rebuilt once per round into this buffer, which is allocated once and shared by
+        // the L and R MSMs of the round.
+        std::vector<Commitment> G_table(poly_degree);
+        Commitment* G_table_ptr = srs_elements;
+
         std::vector<Fr> b_vec(poly_degree);
         run_loop_in_parallel_if_effective(
             poly_degree,
@@ -89,6 +95,10 @@ template <typename Curve> class IPA {
         std::vector<GroupElement> R_elements(log_poly_degree);
         std::size_t round_size = poly_degree;
 
+        // G_vec_local holds the folded generators up to a common factor: the generators of the protocol are
+        // G_vec_scale * G_vec_local. This lets each fold scale only one half of the generators (see below).
+        Fr G_vec_scale = Fr::one();
+
         // Allocate vectors for parallel storage of partial products
         const size_t num_cpus = get_num_cpus();
         std::vector<Fr> partial_inner_prod_L(num_cpus);
@@ -124,13 +134,15 @@ template <typename Curve> class IPA {
             }
 
             // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
-            L_elements[i] = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                &a_vec[0], &G_vec_local[round_size], round_size, ck->pippenger_runtime_state);
+            L_elements[i] = bb::scalar_multiplication::pippenger_unsafe<Curve>(
+                                &a_vec[0], &G_table_ptr[round_size * 2], round_size, ck->pippenger_runtime_state) *
+                            G_vec_scale;
             L_elements[i] += aux_generator * inner_prod_L;
 
             // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
-            R_elements[i] = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                &a_vec[round_size], &G_vec_local[0], round_size, ck->pippenger_runtime_state);
+            R_elements[i] = bb::scalar_multiplication::pippenger_unsafe<Curve>(
+                                &a_vec[round_size], &G_table_ptr[0], round_size, ck->pippenger_runtime_state) *
+                            G_vec_scale;
             R_elements[i] += aux_generator * inner_prod_R;
 
             std::string index = std::to_string(i);
@@ -141,18 +153,11 @@ template <typename Curve> class IPA {
             const Fr round_challenge = transcript->get_challenge("IPA:round_challenge_" + index);
             const Fr round_challenge_inv = round_challenge.invert();
 
-            auto G_lo = GroupElement::batch_mul_with_endomorphism(
-                std::span{ G_vec_local.begin(), G_vec_local.begin() + static_cast<long>(round_size) },
-                round_challenge_inv);
-            auto G_hi = GroupElement::batch_mul_with_endomorphism(
-                std::span{ G_vec_local.begin() + static_cast<long>(round_size),
-                           G_vec_local.begin() + static_cast<long>(round_size * 2) },
-                round_challenge);
-
             // Update the vectors a_vec, b_vec and G_vec.
             // a_vec_next = a_vec_lo * round_challenge + a_vec_hi * round_challenge_inv
             // b_vec_next = b_vec_lo * round_challenge_inv + b_vec_hi * round_challenge
             // G_vec_next = G_vec_lo * round_challenge_inv + G_vec_hi * round_challenge
+            //            = round_challenge_inv * (G_vec_lo + G_vec_hi * round_challenge^2)
             run_loop_in_parallel_if_effective(
                 round_size,
                 [&a_vec, &b_vec, round_challenge, round_challenge_inv, round_size](size_t start, size_t end) {
@@ -166,7 +171,22 @@ template <typename Curve> class IPA {
                 /*finite_field_additions_per_iteration=*/4,
                 /*finite_field_multiplications_per_iteration=*/8,
                 /*finite_field_inversions_per_iteration=*/1);
-            GroupElement::batch_affine_add(G_lo, G_hi, G_vec_local);
+
+            // Fold G_vec in place, deferring the round_challenge_inv factor to G_vec_scale, which halves the number of
+            // batch scalar multiplications of the fold.
+            std::span<Commitment> G_vec_lo{ G_vec_local.begin(), G_vec_local.begin() + static_cast<long>(round_size) };
+            auto G_hi = GroupElement::batch_mul_with_endomorphism(
+                std::span{ G_vec_local.begin() + static_cast<long>(round_size),
+                           G_vec_local.begin() + static_cast<long>(round_size * 2) },
+                round_challenge.sqr());
+            GroupElement::batch_affine_add(G_vec_lo, G_hi, G_vec_lo);
+            G_vec_scale *= round_challenge_inv;
+
+            if (round_size > 1) {
+                bb::scalar_multiplication::generate_pippenger_point_table<Curve>(
+                    &G_vec_local[0], &G_table[0], round_size);
+                G_table_ptr = &G_table[0];
+            }
         }
 
         transcript->send_to_verifier("IPA:a_0", a_vec[0]);
@@ -254,31 +274,10 @@ template <typename Curve> class IPA {
             /*finite_field_additions_per_iteration=*/0,
             /*finite_field_multiplications_per_iteration=*/log_poly_degree);
 
+        // The SRS is stored as a pippenger point table, so the MSM runs on it directly
         auto srs_elements = vk->srs->get_monomial_points();
-
-        // Copy the G_vector to local memory.
-        std::vector<Commitment> G_vec_local(poly_degree);
-
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
-        run_loop_in_parallel_if_effective(
-            poly_degree,
-            [&G_vec_local, srs_elements](size_t start, size_t end) {
-                for (size_t i = start * 2; i < end * 2; i += 2) {
-                    G_vec_local[i >> 1] = srs_elements[i];
-                }
-            },
-            /*finite_field_additions_per_iteration=*/0,
-            /*finite_field_multiplications_per_iteration=*/0,
-            /*finite_field_inversions_per_iteration=*/0,
-            /*group_element_additions_per_iteration=*/0,
-            /*group_element_doublings_per_iteration=*/0,
-            /*scalar_multiplications_per_iteration=*/0,
-            /*sequential_copy_ops_per_iteration=*/1);
-
-        auto G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            &s_vec[0], &G_vec_local[0], poly_degree, vk->pippenger_runtime_state);
+        auto G_zero = bb::scalar_multiplication::pippenger_unsafe<Curve>(
+            &s_vec[0], srs_elements, poly_degree, vk->pippenger_runtime_state);
 
         auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
 
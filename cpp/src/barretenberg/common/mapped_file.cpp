@@ -0,0 +1,215 @@
+#include "mapped_file.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+namespace bb {
+
+void write_zeroes(std::ostream& file, size_t num_bytes)
+{
+    static const std::array<char, MappedSectionsHeader::ALIGNMENT> zeroes{};
+    while (num_bytes > 0) {
+        const size_t chunk_size = std::min(num_bytes, zeroes.size());
+        file.write(zeroes.data(), static_cast<std::streamsize>(chunk_size));
+        num_bytes -= chunk_size;
+    }
+}
+
+void write_file_atomically(std::string const& path,
+                           std::string const& description,
+                           std::function<void(std::ofstream&)> const& write)
+{
+#ifdef __wasm__
+    const std::string temporary_path = path + ".tmp";
+#else
+    const std::string temporary_path = format(path, ".tmp.", getpid());
+#endif
+    {
+        std::ofstream file(temporary_path, std::ofstream::binary | std::ofstream::trunc);
+        write(file);
+        if (!file) {
+            std::remove(temporary_path.c_str());
+            throw_or_abort(format("Failed to write ", description, " ", temporary_path, "."));
+        }
+    }
+    if (std::rename(temporary_path.c_str(), path.c_str()) != 0) {
+        std::remove(temporary_path.c_str());
+        throw_or_abort(format("Failed to move ", description, " to ", path, "."));
+    }
+}
+
+MappedFile::MappedFile(std::string path, const Access access, std::string description, const size_t size)
+    : path_(std::move(path))
+    , access_(access)
+    , description_(std::move(description))
+{
+#ifdef __wasm__
+    static_cast<void>(size);
+    throw_or_abort(format("Failed to map ", description_, " ", path_, ": memory mapping is not supported in wasm."));
+#else
+    const int fd = access_ == Access::READ_WRITE ? open(path_.c_str(), O_RDWR | O_CREAT, 0644)
+                                                 : open(path_.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw_or_abort(format("Failed to open ", description_, " ", path_, "."));
+    }
+    struct stat st {};
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw_or_abort(format("Failed to open ", description_, " ", path_, "."));
+    }
+    const auto file_size = static_cast<size_t>(st.st_size);
+    if (size != SIZE_MAX && size > file_size) {
+        close(fd);
+        throw_or_abort(format("The ", description_, " ", path_, " is truncated."));
+    }
+    const size_t map_size = size == SIZE_MAX ? file_size : size;
+    void* data = map_pages(fd, map_size);
+    // Only a mapping that can be resized needs the file descriptor, the others stay valid after it is closed
+    if (access_ == Access::READ_WRITE && data != MAP_FAILED) {
+        fd_ = fd;
+    } else {
+        close(fd);
+    }
+    if (data == MAP_FAILED) {
+        throw_or_abort(format("Failed to map ", description_, " ", path_, "."));
+    }
+    data_ = static_cast<uint8_t*>(data);
+    size_ = map_size;
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+    unmap();
+#ifndef __wasm__
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+#endif
+}
+
+void MappedFile::resize(const size_t size)
+{
+    ASSERT(access_ == Access::READ_WRITE);
+#ifdef __wasm__
+    static_cast<void>(size);
+#else
+    unmap();
+    if (ftruncate(fd_, static_cast<off_t>(size)) != 0) {
+        throw_or_abort(format("Failed to resize ", description_, " ", path_, "."));
+    }
+    void* data = map_pages(fd_, size);
+    if (data == MAP_FAILED) {
+        throw_or_abort(format("Failed to map ", description_, " ", path_, "."));
+    }
+    data_ = static_cast<uint8_t*>(data);
+    size_ = size;
+#endif
+}
+
+void MappedFile::sync(const size_t begin, const size_t size) const
+{
+    ASSERT(access_ == Access::READ_WRITE);
+#ifdef __wasm__
+    static_cast<void>(begin);
+    static_cast<void>(size);
+#else
+    // msync needs a page aligned address
+    const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t aligned_begin = begin & ~(page_size - 1);
+    if (msync(data_ + aligned_begin, begin + size - aligned_begin, MS_SYNC) != 0) {
+        throw_or_abort(format("Failed to sync ", description_, " ", path_, "."));
+    }
+#endif
+}
+
+void* MappedFile::map_pages(const int fd, const size_t size) const
+{
+#ifdef __wasm__
+    static_cast<void>(fd);
+    static_cast<void>(size);
+    return nullptr;
+#else
+    // mmap rejects empty mappings, an empty file is left unmapped
+    if (size == 0) {
+        return nullptr;
+    }
+    const int protection = access_ == Access::READ_ONLY ? PROT_READ : PROT_READ | PROT_WRITE;
+    const int flags = access_ == Access::COPY_ON_WRITE ? MAP_PRIVATE : MAP_SHARED;
+    return mmap(nullptr, size, protection, flags, fd, 0);
+#endif
+}
+
+void MappedFile::unmap()
+{
+#ifndef __wasm__
+    if (data_ != nullptr) {
+        munmap(data_, size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+
+void write_mapped_sections(std::string const& path,
+                           std::string const& description,
+                           const uint64_t magic,
+                           const uint64_t version,
+                           const uint64_t field_id,
+                           std::vector<uint8_t> const& metadata,
+                           std::vector<MappedSection> const& sections)
+{
+    const size_t data_offset = MappedSectionsHeader::get_section_span(sizeof(MappedSectionsHeader) + metadata.size());
+    const MappedSectionsHeader header{ magic, version, field_id, metadata.size(), data_offset };
+    write_file_atomically(path, description, [&](std::ofstream& file) {
+        file.write(reinterpret_cast<char const*>(&header), sizeof(MappedSectionsHeader));
+        file.write(reinterpret_cast<char const*>(metadata.data()), static_cast<std::streamsize>(metadata.size()));
+        write_zeroes(file, header.data_offset - sizeof(MappedSectionsHeader) - metadata.size());
+        for (const auto& section : sections) {
+            file.write(static_cast<char const*>(section.data), static_cast<std::streamsize>(section.num_bytes));
+            write_zeroes(file, MappedSectionsHeader::get_section_span(section.capacity) - section.num_bytes);
+        }
+    });
+}
+
+MappedSectionsHeader const& read_mapped_sections_header(MappedFile const& file,
+                                                        const uint64_t magic,
+                                                        const uint64_t version,
+                                                        const uint64_t field_id)
+{
+    if (file.size() < sizeof(MappedSectionsHeader)) {
+        throw_or_abort(format("The ", file.description(), " ", file.path(), " is truncated."));
+    }
+    const auto& header = *reinterpret_cast<MappedSectionsHeader const*>(file.data());
+    if (header.magic != magic || header.version != version || header.field_id != field_id) {
+        throw_or_abort(format("The ", file.description(), " ", file.path(), " has an unsupported format."));
+    }
+    if (header.data_offset > file.size() || sizeof(MappedSectionsHeader) + header.metadata_size > header.data_offset) {
+        throw_or_abort(format("The ", file.description(), " ", file.path(), " is truncated."));
+    }
+    return header;
+}
+
+uint8_t* get_mapped_section(MappedFile const& file, const uint64_t offset, const size_t capacity)
+{
+    const auto& header = *reinterpret_cast<MappedSectionsHeader const*>(file.data());
+    if (header.data_offset + offset + capacity > file.size()) {
+        throw_or_abort(format("The ", file.description(), " ", file.path(), " is truncated."));
+    }
+    return file.data() + header.data_offset + offset;
+}
+
+} // namespace bb
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
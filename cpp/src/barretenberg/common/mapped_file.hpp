@@ -0,0 +1,153 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief Rounds `num_bytes` up to a multiple of `alignment`, which must be a power of two
+ */
+constexpr size_t align_up(const size_t num_bytes, const size_t alignment)
+{
+    return (num_bytes + alignment - 1) & ~(alignment - 1);
+}
+
+void write_zeroes(std::ostream& file, size_t num_bytes);
+
+/**
+ * @brief Writes a file through `write` into a temporary file which is then renamed to `path`.
+ *
+ * @details Processes that have an older file at `path` open or mapped are unaffected, and an interrupted write never
+ * leaves a partial file at `path`. `description` names the file in error messages.
+ */
+void write_file_atomically(std::string const& path,
+                           std::string const& description,
+                           std::function<void(std::ofstream&)> const& write);
+
+/**
+ * @brief A memory mapping of a file, unmapped when destroyed.
+ */
+class MappedFile {
+  public:
+    enum class Access {
+        // Shared read-only pages, anything that writes to them faults
+        READ_ONLY,
+        // Private pages: writes copy the page they touch, and neither the file nor other processes see them
+        COPY_ON_WRITE,
+        // Shared writable pages backed by the file, which is created if it does not exist and can be resized
+        READ_WRITE,
+    };
+
+    /**
+     * @param path the file to map
+     * @param access how the pages of the file are mapped
+     * @param description names the file in error messages
+     * @param size the number of bytes to map from the start of the file, all of it if SIZE_MAX
+     */
+    MappedFile(std::string path, Access access, std::string description, size_t size = SIZE_MAX);
+    MappedFile(MappedFile const& other) = delete;
+    MappedFile(MappedFile&& other) = delete;
+    MappedFile& operator=(MappedFile const& other) = delete;
+    MappedFile& operator=(MappedFile&& other) = delete;
+    ~MappedFile();
+
+    uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+    std::string const& path() const { return path_; }
+    std::string const& description() const { return description_; }
+
+    /**
+     * @brief Truncates or extends the file to `size` bytes, zero filled, and maps all of it. READ_WRITE only.
+     *
+     * @details The file may be mapped at another address afterwards.
+     */
+    void resize(size_t size);
+
+    /**
+     * @brief Writes `size` bytes from offset `begin` back to the file and waits until they are on disk. READ_WRITE
+     * only.
+     */
+    void sync(size_t begin, size_t size) const;
+
+  private:
+    void* map_pages(int fd, size_t size) const;
+    void unmap();
+
+    std::string path_;
+    Access access_;
+    std::string description_;
+    // only kept open for READ_WRITE mappings, which can be resized
+    int fd_ = -1;
+    uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+/**
+ * @brief Header of a memory mappable file made of a metadata block and page aligned sections.
+ *
+ * @details The header is followed by `metadata_size` bytes of metadata, whose format is up to the file type. The data
+ * section starts at `data_offset`, and holds sections that each start on an `ALIGNMENT` boundary at the offset the
+ * metadata gives for them. As sections do not share pages, writing to one in a COPY_ON_WRITE mapping only copies its
+ * own pages.
+ */
+struct MappedSectionsHeader {
+    static constexpr uint64_t ALIGNMENT = 4096;
+
+    uint64_t magic;
+    uint64_t version;
+    // the lowest limb of the modulus of the field the sections hold elements of, to reject files for another field
+    uint64_t field_id;
+    uint64_t metadata_size;
+    uint64_t data_offset;
+
+    /**
+     * @brief Space taken in the data section by a section of `num_bytes`
+     */
+    static constexpr size_t get_section_span(const size_t num_bytes) { return align_up(num_bytes, ALIGNMENT); }
+};
+
+/**
+ * @brief A section to be written by `write_mapped_sections`: `num_bytes` from `data`, padded with zeroes to `capacity`
+ * bytes.
+ */
+struct MappedSection {
+    void const* data;
+    size_t num_bytes;
+    size_t capacity;
+};
+
+/**
+ * @brief Atomically writes a file of the MappedSectionsHeader format whose sections are `sections`, in order.
+ *
+ * @details The metadata is expected to locate each section at the sum of the `get_section_span` of the capacities of
+ * the sections before it.
+ */
+void write_mapped_sections(std::string const& path,
+                           std::string const& description,
+                           uint64_t magic,
+                           uint64_t version,
+                           uint64_t field_id,
+                           std::vector<uint8_t> const& metadata,
+                           std::vector<MappedSection> const& sections);
+
+/**
+ * @brief Checks that `file` starts with a MappedSectionsHeader with the given magic, version and field id and that its
+ * metadata is complete, and returns the header.
+ */
+MappedSectionsHeader const& read_mapped_sections_header(MappedFile const& file,
+                                                        uint64_t magic,
+                                                        uint64_t version,
+                                                        uint64_t field_id);
+
+/**
+ * @brief Returns the section of `file` at `offset` into its data section, checking that its `capacity` bytes are in
+ * the file, as a missing page would only fault when accessed.
+ */
+uint8_t* get_mapped_section(MappedFile const& file, uint64_t offset, size_t capacity);
+
+} // namespace bb
@@ -0,0 +1,304 @@
+#include "log.hpp"
+#include "thread.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "barretenberg/common/compiler_hints.hpp"
+
+namespace {
+
+constexpr size_t NOT_A_WORKER = SIZE_MAX;
+
+// The index of the pool worker running on this thread, or NOT_A_WORKER for any other thread (e.g. the main thread).
+thread_local size_t worker_index = NOT_A_WORKER;
+
+/**
+ * A pool of workers that each own a queue of tasks. A worker pushes and pops tasks at the back of its own queue, and
+ * when it runs out of work steals from the front of the other queues. Threads that are not part of the pool push their
+ * tasks onto a shared queue that sits after the worker queues.
+ *
+ * Tasks submitted with a thread hint are pinned: they are held separately and are only ever run by the hinted worker.
+ *
+ * The helper tasks of a parallel_for are queued separately from submitted tasks, and take priority over them. A thread
+ * waiting for the last iterations of a parallel_for only helps out with other parallel_for iterations. Running an
+ * arbitrary task there could hold up the loop for as long as the task takes, and would re-enter whatever the waiting
+ * thread is in the middle of (e.g. a submitted task that commits to a polynomial could end up running inside the
+ * pippenger of another commitment, which shares its runtime state).
+ */
+class WorkStealingPool {
+  public:
+    using Task = std::function<void()>;
+
+    WorkStealingPool(size_t num_threads);
+    WorkStealingPool(const WorkStealingPool& other) = delete;
+    WorkStealingPool(WorkStealingPool&& other) = delete;
+    ~WorkStealingPool();
+
+    WorkStealingPool& operator=(const WorkStealingPool& other) = delete;
+    WorkStealingPool& operator=(WorkStealingPool&& other) = delete;
+
+    [[nodiscard]] size_t num_workers() const { return workers.size(); }
+
+    void submit(Task task, size_t thread_hint);
+    bool try_run_task(bool loop_tasks_only = false);
+    void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
+
+  private:
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<Task> loop_tasks;
+        std::deque<Task> tasks;
+        std::deque<Task> pinned_tasks;
+        std::atomic<size_t> num_pinned = 0;
+    };
+
+    // A parallel_for in flight. Helper tasks only hold on to the job to claim iterations; once every iteration has
+    // been claimed they never touch `func`, so it is safe for the caller to return as soon as `completed` is full.
+    struct Job {
+        const std::function<void(size_t)>* func;
+        size_t num_iterations;
+        std::atomic<size_t> next_iteration = 0;
+        std::atomic<size_t> completed = 0;
+    };
+
+    std::vector<std::unique_ptr<TaskQueue>> queues;
+    // number of tasks (of either kind) that can be run by any thread, i.e. not pinned
+    std::atomic<size_t> num_queued = 0;
+    std::mutex sleep_mutex;
+    std::condition_variable wake_condition;
+    bool stop = false;
+    std::vector<std::thread> workers;
+
+    BBERG_NO_PROFILE void worker_loop(size_t thread_index);
+
+    TaskQueue& local_queue()
+    {
+        return worker_index == NOT_A_WORKER ? *queues.back() : *queues[worker_index];
+    }
+
+    void wake_workers(bool all)
+    {
+        {
+            // Taking the lock orders us after any worker that has just found nothing to do and is about to sleep.
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+        }
+        if (all) {
+            wake_condition.notify_all();
+        } else {
+            wake_condition.notify_one();
+        }
+    }
+
+    static void run_iterations(Job& job)
+    {
+        size_t iteration = 0;
+        size_t num_completed = 0;
+        while ((iteration = job.next_iteration.fetch_add(1, std::memory_order_relaxed)) < job.num_iterations) {
+            (*job.func)(iteration);
+            ++num_completed;
+        }
+        if (num_completed != 0) {
+            job.completed.fetch_add(num_completed, std::memory_order_acq_rel);
+        }
+    }
+};
+
+WorkStealingPool::WorkStealingPool(size_t num_threads)
+{
+    // one queue per worker, plus the shared queue for threads outside the pool
+    queues.reserve(num_threads + 1);
+    for (size_t i = 0; i < num_threads + 1; ++i) {
+        queues.emplace_back(std::make_unique<TaskQueue>());
+    }
+    workers.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        workers.emplace_back(&WorkStealingPool::worker_loop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    wake_condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::submit(Task task, size_t thread_hint)
+{
+    if (workers.empty()) {
+        task();
+        return;
+    }
+    if (thread_hint != ANY_THREAD) {
+        TaskQueue& queue = *queues[thread_hint % workers.size()];
+        {
+            std::unique_lock<std::mutex> lock(queue.mutex);
+            queue.pinned_tasks.emplace_back(std::move(task));
+        }
+        queue.num_pinned.fetch_add(1);
+        // we can't target the hinted worker's wait, so wake everyone and let the others go back to sleep
+        wake_workers(true);
+        return;
+    }
+    // Count the task before it is visible, so a thread that pops it can never take the count below zero.
+    num_queued.fetch_add(1);
+    TaskQueue& queue = local_queue();
+    {
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        queue.tasks.emplace_back(std::move(task));
+    }
+    wake_workers(false);
+}
+
+/**
+ * Runs a single task on the calling thread, if one can be found. Workers look in their own queue first: parallel_for
+ * helpers, then pinned tasks, then the most recently pushed task (which is the one most likely to still be in cache).
+ * Failing that, the oldest parallel_for helper and then the oldest task of every other queue is tried in turn.
+ */
+bool WorkStealingPool::try_run_task(bool loop_tasks_only)
+{
+    Task task;
+    const size_t num_queues = queues.size();
+    const size_t self = worker_index == NOT_A_WORKER ? num_queues - 1 : worker_index;
+    if (worker_index != NOT_A_WORKER) {
+        TaskQueue& queue = *queues[self];
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        if (!queue.loop_tasks.empty()) {
+            task = std::move(queue.loop_tasks.back());
+            queue.loop_tasks.pop_back();
+            num_queued.fetch_sub(1);
+        } else if (!loop_tasks_only && !queue.pinned_tasks.empty()) {
+            task = std::move(queue.pinned_tasks.front());
+            queue.pinned_tasks.pop_front();
+            queue.num_pinned.fetch_sub(1);
+        } else if (!loop_tasks_only && !queue.tasks.empty()) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            num_queued.fetch_sub(1);
+        }
+    }
+    for (size_t pass = 0; pass < (loop_tasks_only ? 1 : 2); ++pass) {
+        for (size_t i = 0; !task && i < num_queues; ++i) {
+            if (num_queued.load(std::memory_order_relaxed) == 0) {
+                break;
+            }
+            TaskQueue& queue = *queues[(self + 1 + i) % num_queues];
+            std::unique_lock<std::mutex> lock(queue.mutex);
+            auto& tasks = pass == 0 ? queue.loop_tasks : queue.tasks;
+            if (!tasks.empty()) {
+                task = std::move(tasks.front());
+                tasks.pop_front();
+                num_queued.fetch_sub(1);
+            }
+        }
+    }
+    if (!task) {
+        return false;
+    }
+    task();
+    return true;
+}
+
+/**
+ * The calling thread pushes one helper task per worker that could join in (at most one fewer than the number of
+ * iterations) onto its own queue and then starts claiming iterations itself. Idle workers steal the helpers, and every
+ * participant claims iterations from the shared job until there are none left.
+ *
+ * As the helpers sit on the caller's queue, a parallel_for that is nested in another one is just more stealable work,
+ * so it spreads over whichever workers are idle instead of serialising or spawning extra threads. While the last
+ * iterations finish on other threads the caller runs the iterations of other parallel_for calls rather than sitting
+ * idle.
+ */
+void WorkStealingPool::parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    if (num_iterations == 0) {
+        return;
+    }
+    if (workers.empty() || num_iterations == 1) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    auto job = std::make_shared<Job>();
+    job->func = &func;
+    job->num_iterations = num_iterations;
+
+    const size_t num_helpers = std::min(num_iterations - 1, workers.size());
+    num_queued.fetch_add(num_helpers);
+    TaskQueue& queue = local_queue();
+    {
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        for (size_t i = 0; i < num_helpers; ++i) {
+            queue.loop_tasks.emplace_back([job] { run_iterations(*job); });
+        }
+    }
+    wake_workers(true);
+
+    run_iterations(*job);
+
+    while (job->completed.load(std::memory_order_acquire) != num_iterations) {
+        if (!try_run_task(/*loop_tasks_only=*/true)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void WorkStealingPool::worker_loop(size_t thread_index)
+{
+    // info("created worker ", thread_index);
+    worker_index = thread_index;
+    TaskQueue& queue = *queues[thread_index];
+    while (true) {
+        if (try_run_task()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        wake_condition.wait(lock, [&] { return stop || num_queued.load() != 0 || queue.num_pinned.load() != 0; });
+        if (stop) {
+            break;
+        }
+    }
+    // info("worker exit ", thread_index);
+}
+
+WorkStealingPool& get_pool()
+{
+    static WorkStealingPool pool(get_num_cpus() - 1);
+    return pool;
+}
+} // namespace
+
+/**
+ * A work stealing strategy. Each worker has its own task queue and steals from the others when it runs dry. The main
+ * thread takes part in every parallel_for it starts, and nested parallel_for calls distribute over idle workers.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    // info("starting job with iterations: ", num_iterations);
+    get_pool().parallel_for(num_iterations, func);
+    // info("done");
+}
+
+void submit_task_work_stealing(std::function<void()> task, size_t thread_hint)
+{
+    get_pool().submit(std::move(task), thread_hint);
+}
+
+bool run_pending_task_work_stealing()
+{
+    return get_pool().try_run_task();
+}
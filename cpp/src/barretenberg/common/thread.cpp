@@ -34,6 +34,11 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: All of the above hand out the iterations of a single parallel_for at a time, so a parallel_for nested in
+ * another one either serialises or oversubscribes, and there is no way for independent pieces of work to run side by
+ * side. "work_stealing" gives every thread its own task queue, lets idle threads steal from busy ones, and runs the
+ * asynchronous tasks of submit_task/spawn_task on the same threads. Defaulting to work_stealing.
  */
 
 // 64 core aws r5.
@@ -68,6 +73,10 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+void submit_task_work_stealing(std::function<void()> task, size_t thread_hint);
+bool run_pending_task_work_stealing();
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -81,9 +90,29 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
+    // parallel_for_mutex_pool(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
+    parallel_for_work_stealing(num_iterations, func);
+#endif
+#endif
+}
+
+void submit_task(std::function<void()> task, size_t thread_hint)
+{
+#ifdef NO_MULTITHREADING
+    (void)thread_hint;
+    task();
+#else
+    submit_task_work_stealing(std::move(task), thread_hint);
 #endif
+}
+
+bool run_pending_task()
+{
+#ifdef NO_MULTITHREADING
+    return false;
+#else
+    return run_pending_task_work_stealing();
 #endif
 }
 
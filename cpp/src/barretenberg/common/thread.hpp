@@ -2,9 +2,14 @@
 #include <atomic>
 #include <barretenberg/env/hardware_concurrency.hpp>
 #include <barretenberg/numeric/bitop/get_msb.hpp>
+#include <chrono>
+#include <cstdint>
 #include <functional>
+#include <future>
 #include <iostream>
+#include <memory>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
 inline size_t get_num_cpus()
@@ -23,6 +28,53 @@ inline size_t get_num_cpus_pow2()
 }
 
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
+
+// Thread hint for tasks that may be run by any thread in the pool.
+constexpr size_t ANY_THREAD = SIZE_MAX;
+
+/**
+ * @brief Queues a task to run asynchronously on the thread pool that backs parallel_for.
+ *
+ * @details A task given a thread hint other than ANY_THREAD is only run by pool thread `thread_hint % num_threads`,
+ * which lets stages that work on the same data keep it in one core's cache. Without threads to hand the task to
+ * (e.g. when built without multithreading) the task is run immediately on the calling thread.
+ */
+void submit_task(std::function<void()> task, size_t thread_hint = ANY_THREAD);
+
+/**
+ * @brief Runs one queued task on the calling thread, if there is one. Returns false if no task could be found.
+ */
+bool run_pending_task();
+
+/**
+ * @brief Runs func asynchronously on the thread pool, and returns a future for its result.
+ *
+ * @details Use wait_for_task to get the result from within another task or parallel_for: blocking in std::future::get
+ * there takes a pool thread out of action, and can deadlock if the task is queued behind the one that is waiting.
+ */
+template <typename Func>
+auto spawn_task(Func&& func, size_t thread_hint = ANY_THREAD) -> std::future<std::invoke_result_t<std::decay_t<Func>>>
+{
+    using Result = std::invoke_result_t<std::decay_t<Func>>;
+    // std::function must be copyable, the packaged task is not
+    auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(func));
+    auto future = task->get_future();
+    submit_task([task]() { (*task)(); }, thread_hint);
+    return future;
+}
+
+/**
+ * @brief Waits for the result of a task from spawn_task, running other queued tasks on this thread in the meantime.
+ */
+template <typename T> T wait_for_task(std::future<T>& future)
+{
+    while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        if (!run_pending_task()) {
+            future.wait_for(std::chrono::microseconds(100));
+        }
+    }
+    return future.get();
+}
 void run_loop_in_parallel(size_t num_points,
                           const std::function<void(size_t, size_t)>& func,
                           size_t no_multhreading_if_less_or_equal = 0);
@@ -0,0 +1,72 @@
+#include "thread.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <vector>
+
+TEST(Thread, ParallelForRunsEveryIterationOnce)
+{
+    constexpr size_t num_iterations = 1000;
+    std::vector<std::atomic<size_t>> counts(num_iterations);
+    parallel_for(num_iterations, [&](size_t i) { counts[i]++; });
+    for (auto& count : counts) {
+        EXPECT_EQ(count.load(), 1UL);
+    }
+}
+
+TEST(Thread, NestedParallelFor)
+{
+    constexpr size_t num_outer = 16;
+    constexpr size_t num_inner = 64;
+    std::vector<std::atomic<size_t>> counts(num_outer * num_inner);
+    parallel_for(num_outer, [&](size_t i) {
+        parallel_for(num_inner, [&](size_t j) {
+            parallel_for(2, [&](size_t k) {
+                if (k == 0) {
+                    counts[i * num_inner + j]++;
+                }
+            });
+        });
+    });
+    for (auto& count : counts) {
+        EXPECT_EQ(count.load(), 1UL);
+    }
+}
+
+TEST(Thread, SpawnTask)
+{
+    auto sum = spawn_task([] {
+        std::vector<size_t> values(1000);
+        parallel_for(values.size(), [&](size_t i) { values[i] = i; });
+        return std::accumulate(values.begin(), values.end(), size_t(0));
+    });
+    auto product = spawn_task([] { return size_t(6) * 7; }, /*thread_hint=*/0);
+    EXPECT_EQ(wait_for_task(sum), 499500UL);
+    EXPECT_EQ(wait_for_task(product), 42UL);
+}
+
+TEST(Thread, WaitForTaskInsideParallelFor)
+{
+    constexpr size_t num_iterations = 32;
+    std::vector<size_t> results(num_iterations);
+    parallel_for(num_iterations, [&](size_t i) {
+        std::vector<std::future<size_t>> futures;
+        for (size_t j = 0; j < 4; ++j) {
+            futures.emplace_back(spawn_task([i, j] { return i * j; }, j));
+        }
+        size_t total = 0;
+        for (auto& future : futures) {
+            total += wait_for_task(future);
+        }
+        results[i] = total;
+    });
+    for (size_t i = 0; i < num_iterations; ++i) {
+        EXPECT_EQ(results[i], i * 6);
+    }
+}
+
+TEST(Thread, TaskExceptionIsPropagated)
+{
+    auto future = spawn_task([]() -> size_t { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(wait_for_task(future), std::runtime_error);
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <array>
+#include <map>
+#include <memory>
+#include <vector>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#include <shared_mutex>
+#endif
+
+namespace bb::crypto {
+/**
+ * @brief Precomputed multiples of a fixed generator, used to speed up native scalar multiplications by it.
+ *
+ * @details The scalar is split into signed digits of `WINDOW_BITS` bits. For the window `j`, the table stores
+ *          `k.[2^{WINDOW_BITS.j}].G` for k = 1, ..., 2^{WINDOW_BITS - 1}, so `scalar.G` is the sum of one (possibly
+ *          negated) table entry per non-zero digit. This replaces the ~127 doublings and the additions of a variable
+ *          base multiplication with `NUM_WINDOWS` mixed additions, and no inversion is needed until the final
+ *          normalisation.
+ *
+ *          Tables are built lazily by `get` the first time a generator is used, and kept for the lifetime of the
+ *          process. As a table only pays for itself after a handful of multiplications, at most `MAX_CACHED_TABLES` are
+ *          built: the generators of a long commitment that is computed once use the variable base multiplication.
+ *
+ * @tparam Curve
+ */
+template <typename Curve> class fixed_base_table {
+  public:
+    using AffineElement = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+
+    static constexpr size_t WINDOW_BITS = 6;
+    static constexpr size_t NUM_ENTRIES_PER_WINDOW = 1UL << (WINDOW_BITS - 1);
+    // one more bit than the scalar for the carry out of the top window
+    static constexpr size_t NUM_WINDOWS = (256 + WINDOW_BITS) / WINDOW_BITS;
+    static constexpr size_t MAX_CACHED_TABLES = 64;
+
+    explicit fixed_base_table(const AffineElement& generator)
+    {
+        std::vector<Element> entries(NUM_WINDOWS * NUM_ENTRIES_PER_WINDOW);
+        Element window_base(generator);
+        for (size_t i = 0; i < NUM_WINDOWS; ++i) {
+            Element* window = &entries[i * NUM_ENTRIES_PER_WINDOW];
+            window[0] = window_base;
+            for (size_t k = 1; k < NUM_ENTRIES_PER_WINDOW; ++k) {
+                window[k] = window[k - 1] + window_base;
+            }
+            // 2^{WINDOW_BITS - 1}.B + 2^{WINDOW_BITS - 1}.B is the base of the next window
+            window_base = window[NUM_ENTRIES_PER_WINDOW - 1].dbl();
+        }
+        Element::batch_normalize(entries.data(), entries.size());
+        table.reserve(entries.size());
+        for (const auto& entry : entries) {
+            table.emplace_back(entry.x, entry.y);
+        }
+    }
+
+    /**
+     * @brief Adds scalar.G into `accumulator`
+     */
+    void accumulate(Element& accumulator, const uint256_t& scalar) const
+    {
+        constexpr uint64_t window_mask = (1UL << WINDOW_BITS) - 1;
+        constexpr uint64_t half_window = 1UL << (WINDOW_BITS - 1);
+        uint64_t carry = 0;
+        for (size_t i = 0; i < NUM_WINDOWS; ++i) {
+            const uint64_t digit = ((scalar >> (i * WINDOW_BITS)).data[0] & window_mask) + carry;
+            if (digit == 0) {
+                continue;
+            }
+            // digits above 2^{WINDOW_BITS - 1} are replaced with (digit - 2^{WINDOW_BITS}) and a carry into the next
+            // window, so that every digit is in [-2^{WINDOW_BITS - 1}, 2^{WINDOW_BITS - 1}]
+            carry = static_cast<uint64_t>(digit > half_window);
+            if (carry == 0) {
+                accumulator += table[i * NUM_ENTRIES_PER_WINDOW + digit - 1];
+            } else if (digit < (1UL << WINDOW_BITS)) {
+                accumulator += -table[i * NUM_ENTRIES_PER_WINDOW + (1UL << WINDOW_BITS) - digit - 1];
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the table of `generator`, building it if needed, or nullptr if the cache is full
+     *
+     * @details Thread safe. Tables are identified by their generator, so generators of every domain separator and
+     * generator context share one cache.
+     */
+    static const fixed_base_table* get(const AffineElement& generator)
+    {
+        const Key key = get_key(generator);
+        {
+#ifndef NO_MULTITHREADING
+            std::shared_lock lock(cache_mutex);
+#endif
+            auto it = cache.find(key);
+            if (it != cache.end()) {
+                return it->second.get();
+            }
+            if (cache.size() >= MAX_CACHED_TABLES) {
+                return nullptr;
+            }
+        }
+        // built outside of the lock, in the rare case of a race the first table inserted is kept
+        auto built = std::make_unique<fixed_base_table>(generator);
+#ifndef NO_MULTITHREADING
+        std::unique_lock lock(cache_mutex);
+#endif
+        if (cache.size() >= MAX_CACHED_TABLES && !cache.contains(key)) {
+            return nullptr;
+        }
+        return cache.try_emplace(key, std::move(built)).first->second.get();
+    }
+
+    /**
+     * @brief Adds scalar.generator into `accumulator`, through the table of `generator` when one can be cached
+     */
+    static void accumulate(Element& accumulator, const AffineElement& generator, const uint256_t& scalar)
+    {
+        const auto* generator_table = get(generator);
+        if (generator_table != nullptr) {
+            generator_table->accumulate(accumulator, scalar);
+        } else {
+            accumulator += Element(generator) * typename Curve::ScalarField(scalar);
+        }
+    }
+
+  private:
+    using Key = std::array<uint64_t, 8>;
+
+    static Key get_key(const AffineElement& generator)
+    {
+        return { generator.x.data[0], generator.x.data[1], generator.x.data[2], generator.x.data[3],
+                 generator.y.data[0], generator.y.data[1], generator.y.data[2], generator.y.data[3] };
+    }
+
+    std::vector<AffineElement> table;
+
+    // NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+#ifndef NO_MULTITHREADING
+    static inline std::shared_mutex cache_mutex;
+#endif
+    static inline std::map<Key, std::unique_ptr<fixed_base_table>> cache;
+    // NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+};
+} // namespace bb::crypto
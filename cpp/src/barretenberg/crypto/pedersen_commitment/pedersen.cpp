@@ -1,4 +1,5 @@
 #include "./pedersen.hpp"
+#include "../generators/fixed_base_table.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include <iostream>
@@ -20,14 +21,27 @@ namespace bb::crypto {
 template <typename Curve>
 typename Curve::AffineElement pedersen_commitment_base<Curve>::commit_native(const std::vector<Fq>& inputs,
                                                                              const GeneratorContext context)
+{
+    return commit_native_projective(inputs, context).normalize();
+}
+
+/**
+ * @brief Computes the pedersen commitment to `inputs` without normalizing it.
+ *
+ * @details The generators are fixed, so the scalar multiplications go through the precomputed tables of
+ * `fixed_base_table`, which are built the first time a generator is used.
+ */
+template <typename Curve>
+typename Curve::Element pedersen_commitment_base<Curve>::commit_native_projective(const std::vector<Fq>& inputs,
+                                                                                  const GeneratorContext context)
 {
     const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
     Element result = Group::point_at_infinity;
 
     for (size_t i = 0; i < inputs.size(); ++i) {
-        result += Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
+        fixed_base_table<Curve>::accumulate(result, generators[i], static_cast<uint256_t>(inputs[i]));
     }
-    return result.normalize();
+    return result;
 }
 template class pedersen_commitment_base<curve::Grumpkin>;
 } // namespace bb::crypto
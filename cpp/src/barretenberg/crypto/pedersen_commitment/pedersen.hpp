@@ -28,6 +28,7 @@ template <typename Curve> class pedersen_commitment_base {
     using GeneratorContext = typename crypto::GeneratorContext<Curve>;
 
     static AffineElement commit_native(const std::vector<Fq>& inputs, GeneratorContext context = {});
+    static Element commit_native_projective(const std::vector<Fq>& inputs, GeneratorContext context = {});
 };
 
 using pedersen_commitment = pedersen_commitment_base<curve::Grumpkin>;
@@ -1,5 +1,6 @@
 #include "pedersen.hpp"
 #include "barretenberg/common/timer.hpp"
+#include "barretenberg/crypto/generators/fixed_base_table.hpp"
 #include "barretenberg/crypto/generators/generator_data.hpp"
 #include <gtest/gtest.h>
 
@@ -28,6 +29,34 @@ TEST(Pedersen, CommitmentWithZero)
     EXPECT_EQ(r, expected);
 }
 
+TEST(Pedersen, FixedBaseTable)
+{
+    using Curve = curve::Grumpkin;
+    using Element = Curve::Element;
+    const auto generator = Curve::Group::derive_generators("fixed_base_table_test", 1)[0];
+    const fixed_base_table<Curve> table(generator);
+
+    std::vector<uint256_t> scalars{ 0,
+                                    1,
+                                    63,
+                                    // every window carries into the next one
+                                    (uint256_t(1) << 252) - 1,
+                                    uint256_t(Curve::ScalarField::modulus) - 1 };
+    for (size_t i = 0; i < 16; ++i) {
+        scalars.emplace_back(Curve::ScalarField::random_element());
+    }
+    for (const auto& scalar : scalars) {
+        Element result = Curve::Group::point_at_infinity;
+        table.accumulate(result, scalar);
+        EXPECT_EQ(result.normalize(), (Element(generator) * Curve::ScalarField(scalar)).normalize());
+
+        // the table adds into a non-trivial accumulator, including the edge case of doubling it
+        Element accumulator(generator);
+        table.accumulate(accumulator, scalar);
+        EXPECT_EQ(accumulator.normalize(), (Element(generator) * (Curve::ScalarField(scalar) + 1)).normalize());
+    }
+}
+
 TEST(Pedersen, CommitmentProf)
 {
     GTEST_SKIP() << "Skipping mini profiler.";
@@ -1,5 +1,7 @@
 #include "./pedersen.hpp"
+#include "../generators/fixed_base_table.hpp"
 #include "../pedersen_commitment/pedersen.hpp"
+#include "barretenberg/common/thread.hpp"
 
 namespace bb::crypto {
 
@@ -56,8 +58,52 @@ std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::convert_buffer
 template <typename Curve>
 typename Curve::BaseField pedersen_hash_base<Curve>::hash(const std::vector<Fq>& inputs, const GeneratorContext context)
 {
-    Element result = length_generator * Fr(inputs.size());
-    return (result + pedersen_commitment_base<Curve>::commit_native(inputs, context)).normalize().x;
+    Element result = pedersen_commitment_base<Curve>::commit_native_projective(inputs, context);
+    fixed_base_table<Curve>::accumulate(result, length_generator, inputs.size());
+    return result.normalize().x;
+}
+
+/**
+ * @brief Hashes each pair of `inputs`, with the same result as calling `hash({ left, right }, context)` on each.
+ *
+ * @details The hashes are kept in projective form and normalized together, so that each thread does a single field
+ * inversion for its share of the batch rather than one per hash. The generators, their tables and the length term
+ * are looked up once for the whole batch.
+ */
+template <typename Curve>
+std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::hash_batch(std::span<const std::array<Fq, 2>> inputs,
+                                                                             const GeneratorContext context)
+{
+    const auto generators = context.generators->get(2, context.offset, context.domain_separator);
+    const std::array<const fixed_base_table<Curve>*, 2> tables{ fixed_base_table<Curve>::get(generators[0]),
+                                                                fixed_base_table<Curve>::get(generators[1]) };
+    const AffineElement length_term = Element(length_generator) * Fr(2);
+
+    std::vector<Fq> results(inputs.size());
+    run_loop_in_parallel_if_effective(
+        inputs.size(),
+        [&](size_t start, size_t end) {
+            std::vector<Element> points(end - start, Element(length_term));
+            for (size_t i = start; i < end; ++i) {
+                for (size_t j = 0; j < 2; ++j) {
+                    const auto scalar = static_cast<uint256_t>(inputs[i][j]);
+                    if (tables[j] != nullptr) {
+                        tables[j]->accumulate(points[i - start], scalar);
+                    } else {
+                        points[i - start] += Element(generators[j]) * Fr(scalar);
+                    }
+                }
+            }
+            Element::batch_normalize(points.data(), points.size());
+            for (size_t i = start; i < end; ++i) {
+                results[i] = points[i - start].x;
+            }
+        },
+        /*finite_field_additions_per_iteration=*/0,
+        /*finite_field_multiplications_per_iteration=*/0,
+        /*finite_field_inversions_per_iteration=*/0,
+        /*group_element_additions_per_iteration=*/2 * fixed_base_table<Curve>::NUM_WINDOWS);
+    return results;
 }
 
 /**
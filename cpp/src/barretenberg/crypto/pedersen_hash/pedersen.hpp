@@ -2,6 +2,8 @@
 
 #include "../generators/generator_data.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <array>
+#include <span>
 namespace bb::crypto {
 /**
  * @brief Performs pedersen hashes!
@@ -30,6 +32,7 @@ template <typename Curve> class pedersen_hash_base {
     using GeneratorContext = typename crypto::GeneratorContext<Curve>;
     inline static constexpr AffineElement length_generator = Group::derive_generators("pedersen_hash_length", 1)[0];
     static Fq hash(const std::vector<Fq>& inputs, GeneratorContext context = {});
+    static std::vector<Fq> hash_batch(std::span<const std::array<Fq, 2>> inputs, GeneratorContext context = {});
     static Fq hash_buffer(const std::vector<uint8_t>& input, GeneratorContext context = {});
 
   private:
@@ -21,4 +21,22 @@ TEST(Pedersen, HashWithIndex)
     EXPECT_EQ(r, fr(uint256_t("1c446df60816b897cda124524e6b03f36df0cec333fad87617aab70d7861daa6")));
 }
 
-} // namespace bb::crypto
\ No newline at end of file
+TEST(Pedersen, HashBatch)
+{
+    std::vector<std::array<fr, 2>> inputs(33);
+    for (auto& input : inputs) {
+        input = { fr::random_element(), fr::random_element() };
+    }
+    inputs[0] = { fr::zero(), fr::zero() };
+
+    for (const size_t hash_index : { 0, 5 }) {
+        const auto results = pedersen_hash::hash_batch(inputs, hash_index);
+        ASSERT_EQ(results.size(), inputs.size());
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            EXPECT_EQ(results[i], pedersen_hash::hash({ inputs[i][0], inputs[i][1] }, hash_index));
+        }
+    }
+    EXPECT_TRUE(pedersen_hash::hash_batch({}).empty());
+}
+
+} // namespace bb::crypto
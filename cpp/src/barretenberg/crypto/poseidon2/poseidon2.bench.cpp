@@ -24,4 +24,16 @@ void native_poseidon2_commitment_bench(State& state) noexcept
 }
 BENCHMARK(native_poseidon2_commitment_bench)->Arg(10)->Arg(1000)->Arg(10000);
 
+void native_poseidon2_hash_batch_bench(State& state) noexcept
+{
+    std::vector<std::array<grumpkin::fq, 2>> inputs(static_cast<size_t>(state.range(0)));
+    for (auto& input : inputs) {
+        input = { grumpkin::fq::random_element(), grumpkin::fq::random_element() };
+    }
+    for (auto _ : state) {
+        DoNotOptimize(bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_batch(inputs));
+    }
+}
+BENCHMARK(native_poseidon2_hash_batch_bench)->Arg(1 << 10)->Arg(1 << 16);
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "poseidon2.hpp"
+#include "barretenberg/common/thread.hpp"
 
 namespace bb::crypto {
 /**
@@ -11,6 +12,30 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash(const std::vector<typenam
     return Sponge::hash_fixed_length(input_span);
 }
 
+/**
+ * @brief Hashes each pair of `inputs`, spreading the batch across threads
+ * @details Unlike pedersen, poseidon2 has no inversion to share between the hashes of a batch
+ */
+template <typename Params>
+std::vector<typename Poseidon2<Params>::FF> Poseidon2<Params>::hash_batch(
+    std::span<const std::array<typename Poseidon2<Params>::FF, 2>> inputs)
+{
+    std::vector<FF> results(inputs.size());
+    // a permutation of width 4 costs about 300 multiplications
+    constexpr size_t multiplications_per_hash = 300;
+    run_loop_in_parallel_if_effective(
+        inputs.size(),
+        [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                std::array<FF, 2> input = inputs[i];
+                results[i] = Sponge::hash_fixed_length(input);
+            }
+        },
+        /*finite_field_additions_per_iteration=*/0,
+        /*finite_field_multiplications_per_iteration=*/multiplications_per_hash);
+    return results;
+}
+
 /**
  * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
  * @details Slice function cuts out the required number of bytes from the byte vector
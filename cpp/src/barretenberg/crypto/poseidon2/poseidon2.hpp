@@ -3,6 +3,8 @@
 #include "poseidon2_params.hpp"
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
+#include <array>
+#include <span>
 
 namespace bb::crypto {
 
@@ -17,6 +19,10 @@ template <typename Params> class Poseidon2 {
      * @brief Hashes a vector of field elements
      */
     static FF hash(const std::vector<FF>& input);
+    /**
+     * @brief Hashes each pair of `inputs`, spreading the batch across threads
+     */
+    static std::vector<FF> hash_batch(std::span<const std::array<FF, 2>> inputs);
     /**
      * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
      * @details Slice function cuts out the required number of bytes from the byte vector
@@ -47,6 +47,21 @@ TEST(Poseidon2, HashConsistencyCheck)
     EXPECT_EQ(result, expected);
 }
 
+TEST(Poseidon2, HashBatch)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+    std::vector<std::array<bb::fr, 2>> inputs(33);
+    for (auto& input : inputs) {
+        input = { bb::fr::random_element(&engine), bb::fr::random_element(&engine) };
+    }
+
+    const auto results = Poseidon2::hash_batch(inputs);
+    ASSERT_EQ(results.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(results[i], Poseidon2::hash({ inputs[i][0], inputs[i][1] }));
+    }
+}
+
 TEST(Poseidon2, HashBufferConsistencyCheck)
 {
     // 31 byte inputs because hash_buffer slicing is only injective with 31 bytes, as it slices 31 bytes for each field
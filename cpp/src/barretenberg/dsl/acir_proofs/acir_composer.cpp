@@ -40,6 +40,19 @@ std::shared_ptr<bb::plonk::proving_key> AcirComposer::init_proving_key()
     return proving_key_;
 }
 
+/**
+ * @brief Use a precomputed proving key of the circuit, e.g. one mapped by read_mmap_proving_key, instead of computing it
+ */
+void AcirComposer::load_proving_key(bb::plonk::proving_key_data&& data)
+{
+    if (data.circuit_size != get_dyadic_circuit_size()) {
+        throw_or_abort("Proving key does not match the circuit.");
+    }
+    const size_t crs_size = data.circuit_size + 1;
+    proving_key_ =
+        std::make_shared<bb::plonk::proving_key>(std::move(data), srs::get_crs_factory()->get_prover_crs(crs_size));
+}
+
 std::vector<uint8_t> AcirComposer::create_proof(bool is_recursive)
 {
     if (!proving_key_) {
@@ -22,6 +22,8 @@ class AcirComposer {
 
     std::shared_ptr<bb::plonk::proving_key> init_proving_key();
 
+    void load_proving_key(bb::plonk::proving_key_data&& data);
+
     std::vector<uint8_t> create_proof(bool is_recursive);
 
     void load_verification_key(bb::plonk::verification_key_data&& data);
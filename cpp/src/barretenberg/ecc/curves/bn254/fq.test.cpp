@@ -464,6 +464,41 @@ TEST(fq, SerializeFromBuffer)
     EXPECT_EQ((result == expected), true);
 }
 
+// The batched operations must agree with the scalar ones, including on the elements left over after the vectorised
+// lanes and on inputs in coarse form
+TEST(fq, BatchOperations)
+{
+    const size_t n = 37;
+    std::vector<fq> a(n);
+    std::vector<fq> b(n);
+    for (size_t i = 0; i < n; ++i) {
+        a[i] = fq::random_element();
+        b[i] = fq::random_element();
+    }
+    a[0] = fq::zero();
+    a[1] = fq::neg_one();
+    b[1] = fq::neg_one();
+    a[2] = a[2] + a[3];
+
+    std::vector<fq> products(n);
+    std::vector<fq> squares(n);
+    std::vector<fq> sums(n);
+    fq::mul_batch(a, b, products);
+    fq::sqr_batch(a, squares);
+    fq::add_batch(a, b, sums);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(products[i], a[i] * b[i]);
+        EXPECT_EQ(squares[i], a[i].sqr());
+        EXPECT_EQ(sums[i], a[i] + b[i]);
+    }
+
+    // The outputs are valid inputs, and the result can alias an input
+    fq::mul_batch(products, squares, products);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(products[i], (a[i] * b[i]) * a[i].sqr());
+    }
+}
+
 TEST(fq, MultiplicativeGenerator)
 {
     EXPECT_EQ(fq::multiplicative_generator(), fq(3));
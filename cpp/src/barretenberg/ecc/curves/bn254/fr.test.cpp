@@ -360,6 +360,82 @@ TEST(fr, BatchInvert)
     }
 }
 
+// Long enough for the interleaved chains on CPUs with AVX-512 IFMA, with a tail that is not a multiple of the number of
+// chains and with zeros (which must be left untouched) in several chains
+TEST(fr, BatchInvertMultiLane)
+{
+    const size_t n = 1005;
+    std::vector<fr> coeffs(n);
+    for (size_t i = 0; i < n; ++i) {
+        coeffs[i] = (i % 37 == 0) ? fr::zero() : fr::random_element();
+    }
+    std::vector<fr> inverses = coeffs;
+    fr::batch_invert(inverses);
+
+    for (size_t i = 0; i < n; ++i) {
+        if (coeffs[i].is_zero()) {
+            EXPECT_TRUE(inverses[i].is_zero());
+        } else {
+            EXPECT_EQ(coeffs[i] * inverses[i], fr::one());
+        }
+    }
+}
+
+// Large enough to be split across threads, with zeros (which must be left untouched) scattered through the chunks
+TEST(fr, ParallelBatchInvert)
+{
+    const size_t n = (1UL << 16) + 7;
+    std::vector<fr> coeffs(n);
+    for (size_t i = 0; i < n; ++i) {
+        coeffs[i] = (i % 1000 == 0) ? fr::zero() : fr::random_element();
+    }
+    std::vector<fr> inverses = coeffs;
+    fr::parallel_batch_invert(inverses);
+
+    for (size_t i = 0; i < n; ++i) {
+        if (coeffs[i].is_zero()) {
+            EXPECT_TRUE(inverses[i].is_zero());
+        } else {
+            EXPECT_EQ(coeffs[i] * inverses[i], fr::one());
+        }
+    }
+}
+
+// The batched operations must agree with the scalar ones, including on the elements left over after the vectorised
+// lanes and on inputs in coarse form
+TEST(fr, BatchOperations)
+{
+    const size_t n = 37;
+    std::vector<fr> a(n);
+    std::vector<fr> b(n);
+    for (size_t i = 0; i < n; ++i) {
+        a[i] = fr::random_element();
+        b[i] = fr::random_element();
+    }
+    a[0] = fr::zero();
+    a[1] = fr::neg_one();
+    b[1] = fr::neg_one();
+    a[2] = a[2] + a[3];
+
+    std::vector<fr> products(n);
+    std::vector<fr> squares(n);
+    std::vector<fr> sums(n);
+    fr::mul_batch(a, b, products);
+    fr::sqr_batch(a, squares);
+    fr::add_batch(a, b, sums);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(products[i], a[i] * b[i]);
+        EXPECT_EQ(squares[i], a[i].sqr());
+        EXPECT_EQ(sums[i], a[i] + b[i]);
+    }
+
+    // The outputs are valid inputs, and the result can alias an input
+    fr::mul_batch(products, squares, products);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(products[i], (a[i] * b[i]) * a[i].sqr());
+    }
+}
+
 TEST(fr, MultiplicativeGenerator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
@@ -245,6 +245,20 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+    /**
+     * @brief Multithreaded batch_invert for large spans. Each thread runs Montgomery's trick over its own chunk, the
+     * chunk products share a single inversion, and the chunks are written back in parallel. Zeros are left untouched.
+     */
+    static void parallel_batch_invert(std::span<field> coeffs) noexcept;
+
+    /**
+     * @brief Element-wise operations over spans of the same size. The result may alias either input.
+     * @details On CPUs with AVX-512 IFMA, multiplication and squaring of fields with a modulus of at most 254 bits run
+     * eight lanes at a time (see field_impl_ifma.hpp), the rest of the elements use the scalar code.
+     */
+    static void mul_batch(std::span<const field> a, std::span<const field> b, std::span<field> result) noexcept;
+    static void sqr_batch(std::span<const field> a, std::span<field> result) noexcept;
+    static void add_batch(std::span<const field> a, std::span<const field> b, std::span<field> result) noexcept;
     /**
      * @brief Compute square root of the field element.
      *
@@ -447,6 +461,10 @@ template <class Params_> struct alignas(32) field {
     void msgpack_schema(auto& packer) const { packer.pack_alias(Params::schema_name, "bin32"); }
 
   private:
+    // Below this size the per-row overhead of batch_invert_multi_lane outweighs the faster multiplications
+    static constexpr size_t MIN_MULTI_LANE_BATCH_INVERT_SIZE = 64;
+    static void batch_invert_multi_lane(std::span<field> coeffs) noexcept;
+
     static constexpr uint256_t twice_modulus = modulus + modulus;
     static constexpr uint256_t not_modulus = -modulus;
     static constexpr uint256_t twice_not_modulus = -twice_modulus;
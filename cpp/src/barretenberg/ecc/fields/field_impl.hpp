@@ -1,14 +1,17 @@
 #pragma once
 #include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
+#include <array>
 #include <memory>
 #include <span>
 #include <type_traits>
 #include <vector>
 
 #include "./field_declarations.hpp"
+#include "./field_impl_ifma.hpp"
 
 namespace bb {
 
@@ -380,6 +383,12 @@ template <class T> void field<T>::batch_invert(field* coeffs, const size_t n) no
 template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
 {
     const size_t n = coeffs.size();
+    if constexpr (field_ifma::is_supported_modulus<T>()) {
+        if (n >= MIN_MULTI_LANE_BATCH_INVERT_SIZE && field_ifma::cpu_supports_ifma()) {
+            batch_invert_multi_lane(coeffs);
+            return;
+        }
+    }
 
     auto temporaries_ptr = std::static_pointer_cast<field[]>(get_mem_slab(n * sizeof(field)));
     auto skipped_ptr = std::static_pointer_cast<bool[]>(get_mem_slab(n));
@@ -425,6 +434,148 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
     }
 }
 
+/**
+ * @brief Montgomery's trick over field_ifma::NUM_LANES interleaved chains, the j-th of which inverts the elements at
+ * positions j mod NUM_LANES. The chains advance together, so that their multiplications run on the multi-lane kernels,
+ * and still share a single inversion. The last n mod NUM_LANES elements are inverted by the scalar code.
+ */
+template <class T> void field<T>::batch_invert_multi_lane(std::span<field> coeffs) noexcept
+{
+    constexpr size_t NUM_LANES = field_ifma::NUM_LANES;
+    const size_t num_rows = coeffs.size() / NUM_LANES;
+    const auto lanes = [](field* ptr) { return reinterpret_cast<uint64_t*>(ptr); };
+
+    auto temporaries_ptr = std::static_pointer_cast<field[]>(get_mem_slab(num_rows * NUM_LANES * sizeof(field)));
+    auto* temporaries = temporaries_ptr.get();
+
+    // Zeros are skipped by multiplying by one instead
+    std::array<field, NUM_LANES> accumulators;
+    std::array<field, NUM_LANES> row;
+    accumulators.fill(one());
+    for (size_t i = 0; i < num_rows; ++i) {
+        field* current = &coeffs[i * NUM_LANES];
+        for (size_t j = 0; j < NUM_LANES; ++j) {
+            temporaries[i * NUM_LANES + j] = accumulators[j];
+            row[j] = current[j].is_zero() ? one() : current[j];
+        }
+        field_ifma::mul_batch<T>(lanes(accumulators.data()), lanes(row.data()), lanes(accumulators.data()), NUM_LANES);
+    }
+
+    // A chain never contains zeros, so the products of the chains can be inverted together
+    batch_invert(std::span{ accumulators });
+
+    std::array<field, NUM_LANES> inverses;
+    for (size_t i = num_rows - 1; i < num_rows; --i) {
+        field* current = &coeffs[i * NUM_LANES];
+        for (size_t j = 0; j < NUM_LANES; ++j) {
+            row[j] = current[j].is_zero() ? one() : current[j];
+        }
+        field_ifma::mul_batch<T>(
+            lanes(accumulators.data()), lanes(&temporaries[i * NUM_LANES]), lanes(inverses.data()), NUM_LANES);
+        field_ifma::mul_batch<T>(lanes(accumulators.data()), lanes(row.data()), lanes(accumulators.data()), NUM_LANES);
+        for (size_t j = 0; j < NUM_LANES; ++j) {
+            if (!current[j].is_zero()) {
+                current[j] = inverses[j];
+            }
+        }
+    }
+
+    batch_invert(coeffs.subspan(num_rows * NUM_LANES));
+}
+
+template <class T> void field<T>::parallel_batch_invert(std::span<field> coeffs) noexcept
+{
+    // Below this many elements per thread the extra pass over the chunk products is not worth the threading overhead
+    constexpr size_t MIN_CHUNK_SIZE = 1UL << 12;
+    const size_t n = coeffs.size();
+    const size_t num_chunks = std::min(get_num_cpus(), n / MIN_CHUNK_SIZE);
+    if (num_chunks <= 1) {
+        batch_invert(coeffs);
+        return;
+    }
+    const size_t chunk_size = (n + num_chunks - 1) / num_chunks;
+
+    auto temporaries_ptr = std::static_pointer_cast<field[]>(get_mem_slab(n * sizeof(field)));
+    auto temporaries = temporaries_ptr.get();
+    std::vector<field> chunk_products(num_chunks);
+
+    // Prefix products of every chunk, skipping zeros
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const size_t start = chunk * chunk_size;
+        const size_t end = std::min(start + chunk_size, n);
+        field accumulator = one();
+        for (size_t i = start; i < end; ++i) {
+            temporaries[i] = accumulator;
+            if (!coeffs[i].is_zero()) {
+                accumulator *= coeffs[i];
+            }
+        }
+        chunk_products[chunk] = accumulator;
+    });
+
+    // One inversion is shared by all of the chunks
+    batch_invert(chunk_products);
+
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const size_t start = chunk * chunk_size;
+        const size_t end = std::min(start + chunk_size, n);
+        field accumulator = chunk_products[chunk];
+        field T0;
+        for (size_t i = end - 1; i + 1 > start; --i) {
+            if (!coeffs[i].is_zero()) {
+                T0 = accumulator * temporaries[i];
+                accumulator *= coeffs[i];
+                coeffs[i] = T0;
+            }
+        }
+    });
+}
+
+template <class T>
+void field<T>::mul_batch(std::span<const field> a, std::span<const field> b, std::span<field> result) noexcept
+{
+    ASSERT(a.size() == result.size() && b.size() == result.size());
+    const size_t n = result.size();
+    size_t i = 0;
+    if constexpr (field_ifma::is_supported_modulus<T>()) {
+        if (field_ifma::cpu_supports_ifma()) {
+            i = field_ifma::mul_batch<T>(reinterpret_cast<const uint64_t*>(a.data()),
+                                         reinterpret_cast<const uint64_t*>(b.data()),
+                                         reinterpret_cast<uint64_t*>(result.data()),
+                                         n);
+        }
+    }
+    for (; i < n; ++i) {
+        result[i] = a[i] * b[i];
+    }
+}
+
+template <class T> void field<T>::sqr_batch(std::span<const field> a, std::span<field> result) noexcept
+{
+    ASSERT(a.size() == result.size());
+    const size_t n = result.size();
+    size_t i = 0;
+    if constexpr (field_ifma::is_supported_modulus<T>()) {
+        if (field_ifma::cpu_supports_ifma()) {
+            i = field_ifma::sqr_batch<T>(
+                reinterpret_cast<const uint64_t*>(a.data()), reinterpret_cast<uint64_t*>(result.data()), n);
+        }
+    }
+    for (; i < n; ++i) {
+        result[i] = a[i].sqr();
+    }
+}
+
+template <class T>
+void field<T>::add_batch(std::span<const field> a, std::span<const field> b, std::span<field> result) noexcept
+{
+    // Addition is bound by memory bandwidth rather than by the carry chain, so the scalar code is as fast as it gets
+    ASSERT(a.size() == result.size() && b.size() == result.size());
+    for (size_t i = 0; i < result.size(); ++i) {
+        result[i] = a[i] + b[i];
+    }
+}
+
 template <class T> constexpr field<T> field<T>::tonelli_shanks_sqrt() const noexcept
 {
     // Tonelli-shanks algorithm begins by finding a field element Q and integer S,
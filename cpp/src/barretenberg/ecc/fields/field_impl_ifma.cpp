@@ -0,0 +1,240 @@
+/**
+ * @file field_impl_ifma.cpp
+ * @brief Multi-lane Montgomery multiplication kernels over AVX-512 IFMA, see field_impl_ifma.hpp.
+ *
+ * @details Eight field elements are processed at once, one per 64-bit lane. Each element is split into five 52-bit
+ * limbs so that the 52x52-bit multiply-accumulate instructions (vpmadd52luq / vpmadd52huq) can be used, and the
+ * Montgomery reduction is done in radix 2^52 with R' = 2^260. Since elements are stored in Montgomery form with
+ * R = 2^256, one operand is shifted left by 4 bits on load, so that a * (16 * b) / R' = a * b / R.
+ *
+ * For a modulus p < 2^254 and inputs in [0, 2p), the output is in [0, 2p), just like the coarse reduction of the
+ * scalar multiplication. The kernels are compiled with a function-level target attribute and selected at runtime,
+ * so the rest of the library does not need to be built for AVX-512.
+ */
+#include "field_impl_ifma.hpp"
+
+#if defined(__x86_64__) && !defined(__wasm__) && !defined(DISABLE_SHENANIGANS)
+#define BBERG_HAS_IFMA_KERNELS 1
+#include <immintrin.h>
+#else
+#define BBERG_HAS_IFMA_KERNELS 0
+#endif
+
+namespace bb::field_ifma {
+
+#if BBERG_HAS_IFMA_KERNELS
+
+#define BBERG_IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+
+namespace {
+
+struct Limbs52 {
+    __m512i limb[5];
+};
+
+/**
+ * @brief Load 8 consecutive elements and transpose them into 4 vectors, the i-th holding the i-th 64-bit limb of each
+ * element.
+ */
+BBERG_IFMA_TARGET inline void load_transposed(const uint64_t* src, __m512i& l0, __m512i& l1, __m512i& l2, __m512i& l3)
+{
+    const __m512i v0 = _mm512_loadu_si512(src);
+    const __m512i v1 = _mm512_loadu_si512(src + 8);
+    const __m512i v2 = _mm512_loadu_si512(src + 16);
+    const __m512i v3 = _mm512_loadu_si512(src + 24);
+    // Gather limbs 0 and 1 (resp. 2 and 3) of 4 elements
+    const __m512i lo_limbs = _mm512_set_epi64(13, 9, 5, 1, 12, 8, 4, 0);
+    const __m512i hi_limbs = _mm512_set_epi64(15, 11, 7, 3, 14, 10, 6, 2);
+    const __m512i a01 = _mm512_permutex2var_epi64(v0, lo_limbs, v1);
+    const __m512i a23 = _mm512_permutex2var_epi64(v0, hi_limbs, v1);
+    const __m512i b01 = _mm512_permutex2var_epi64(v2, lo_limbs, v3);
+    const __m512i b23 = _mm512_permutex2var_epi64(v2, hi_limbs, v3);
+    // Then merge the halves of the 8 elements
+    const __m512i lo_halves = _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0);
+    const __m512i hi_halves = _mm512_set_epi64(15, 14, 13, 12, 7, 6, 5, 4);
+    l0 = _mm512_permutex2var_epi64(a01, lo_halves, b01);
+    l1 = _mm512_permutex2var_epi64(a01, hi_halves, b01);
+    l2 = _mm512_permutex2var_epi64(a23, lo_halves, b23);
+    l3 = _mm512_permutex2var_epi64(a23, hi_halves, b23);
+}
+
+/**
+ * @brief Inverse of load_transposed.
+ */
+BBERG_IFMA_TARGET inline void store_transposed(uint64_t* dst, __m512i l0, __m512i l1, __m512i l2, __m512i l3)
+{
+    const __m512i lo_halves = _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0);
+    const __m512i hi_halves = _mm512_set_epi64(15, 14, 13, 12, 7, 6, 5, 4);
+    const __m512i a01 = _mm512_permutex2var_epi64(l0, lo_halves, l1);
+    const __m512i b01 = _mm512_permutex2var_epi64(l0, hi_halves, l1);
+    const __m512i a23 = _mm512_permutex2var_epi64(l2, lo_halves, l3);
+    const __m512i b23 = _mm512_permutex2var_epi64(l2, hi_halves, l3);
+    const __m512i lo_limbs = _mm512_set_epi64(13, 9, 5, 1, 12, 8, 4, 0);
+    const __m512i hi_limbs = _mm512_set_epi64(15, 11, 7, 3, 14, 10, 6, 2);
+    _mm512_storeu_si512(dst, _mm512_permutex2var_epi64(a01, lo_limbs, a23));
+    _mm512_storeu_si512(dst + 8, _mm512_permutex2var_epi64(a01, hi_limbs, a23));
+    _mm512_storeu_si512(dst + 16, _mm512_permutex2var_epi64(b01, lo_limbs, b23));
+    _mm512_storeu_si512(dst + 24, _mm512_permutex2var_epi64(b01, hi_limbs, b23));
+}
+
+/**
+ * @brief Split 8 elements of 4 64-bit limbs into 5 52-bit limbs, multiplying them by 2^shift on the way.
+ */
+template <int shift>
+BBERG_IFMA_TARGET inline Limbs52 to_radix_52(__m512i l0, __m512i l1, __m512i l2, __m512i l3)
+{
+    static_assert(shift >= 0 && shift < 12);
+    const __m512i mask = _mm512_set1_epi64(0xFFFFFFFFFFFFFULL);
+    Limbs52 result;
+    result.limb[0] = _mm512_and_si512(_mm512_slli_epi64(l0, shift), mask);
+    result.limb[1] =
+        _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(l0, 52 - shift), _mm512_slli_epi64(l1, 12 + shift)), mask);
+    result.limb[2] =
+        _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(l1, 40 - shift), _mm512_slli_epi64(l2, 24 + shift)), mask);
+    result.limb[3] =
+        _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(l2, 28 - shift), _mm512_slli_epi64(l3, 36 + shift)), mask);
+    result.limb[4] = _mm512_srli_epi64(l3, 16 - shift);
+    return result;
+}
+
+/**
+ * @brief The modulus in radix 2^52, broadcast to every lane.
+ */
+struct Modulus52 {
+    __m512i limb[5];
+    // -p^{-1} mod 2^52
+    __m512i r_inv;
+};
+
+BBERG_IFMA_TARGET inline Modulus52 broadcast_modulus(const Modulus& modulus)
+{
+    const uint64_t mask = 0xFFFFFFFFFFFFFULL;
+    const uint64_t* p = modulus.limbs.data();
+    Modulus52 result;
+    result.limb[0] = _mm512_set1_epi64(static_cast<int64_t>(p[0] & mask));
+    result.limb[1] = _mm512_set1_epi64(static_cast<int64_t>(((p[0] >> 52) | (p[1] << 12)) & mask));
+    result.limb[2] = _mm512_set1_epi64(static_cast<int64_t>(((p[1] >> 40) | (p[2] << 24)) & mask));
+    result.limb[3] = _mm512_set1_epi64(static_cast<int64_t>(((p[2] >> 28) | (p[3] << 36)) & mask));
+    result.limb[4] = _mm512_set1_epi64(static_cast<int64_t>(p[3] >> 16));
+    result.r_inv = _mm512_set1_epi64(static_cast<int64_t>(modulus.r_inv & mask));
+    return result;
+}
+
+/**
+ * @brief Montgomery multiplication of 8 pairs of elements in radix 2^52, returning 4 64-bit limb vectors.
+ * @details Carries are only propagated at the end: every limb of the accumulator receives at most four 52-bit terms
+ * per iteration, which keeps it far below 2^64.
+ */
+BBERG_IFMA_TARGET inline void montgomery_mul_8(const Limbs52& a,
+                                               const Limbs52& b,
+                                               const Modulus52& modulus,
+                                               __m512i* out)
+{
+    const __m512i mask = _mm512_set1_epi64(0xFFFFFFFFFFFFFULL);
+    const __m512i zero = _mm512_setzero_si512();
+
+    __m512i t[6] = { zero, zero, zero, zero, zero, zero };
+    for (size_t i = 0; i < 5; i++) {
+        for (size_t j = 0; j < 5; j++) {
+            t[j] = _mm512_madd52lo_epu64(t[j], a.limb[i], b.limb[j]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], a.limb[i], b.limb[j]);
+        }
+        const __m512i m = _mm512_madd52lo_epu64(zero, t[0], modulus.r_inv);
+        for (size_t j = 0; j < 5; j++) {
+            t[j] = _mm512_madd52lo_epu64(t[j], m, modulus.limb[j]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m, modulus.limb[j]);
+        }
+        // The lowest limb is now divisible by 2^52, shift the accumulator down by one limb
+        t[0] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+        for (size_t j = 1; j < 5; j++) {
+            t[j] = t[j + 1];
+        }
+        t[5] = zero;
+    }
+
+    // Normalise the limbs to 52 bits
+    for (size_t j = 0; j < 4; j++) {
+        t[j + 1] = _mm512_add_epi64(t[j + 1], _mm512_srli_epi64(t[j], 52));
+        t[j] = _mm512_and_si512(t[j], mask);
+    }
+
+    // Back to 4 64-bit limbs
+    out[0] = _mm512_or_si512(t[0], _mm512_slli_epi64(t[1], 52));
+    out[1] = _mm512_or_si512(_mm512_srli_epi64(t[1], 12), _mm512_slli_epi64(t[2], 40));
+    out[2] = _mm512_or_si512(_mm512_srli_epi64(t[2], 24), _mm512_slli_epi64(t[3], 28));
+    out[3] = _mm512_or_si512(_mm512_srli_epi64(t[3], 36), _mm512_slli_epi64(t[4], 16));
+}
+
+} // namespace
+
+bool cpu_supports_ifma()
+{
+    static const bool supported = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+    return supported;
+}
+
+BBERG_IFMA_TARGET size_t mul_batch(const uint64_t* a,
+                                   const uint64_t* b,
+                                   uint64_t* result,
+                                   const size_t n,
+                                   const Modulus& modulus)
+{
+    const Modulus52 modulus_52 = broadcast_modulus(modulus);
+    const size_t num_processed = n - (n % NUM_LANES);
+    for (size_t i = 0; i < num_processed; i += NUM_LANES) {
+        __m512i l0;
+        __m512i l1;
+        __m512i l2;
+        __m512i l3;
+        load_transposed(a + 4 * i, l0, l1, l2, l3);
+        const Limbs52 a_limbs = to_radix_52<0>(l0, l1, l2, l3);
+        load_transposed(b + 4 * i, l0, l1, l2, l3);
+        const Limbs52 b_limbs = to_radix_52<4>(l0, l1, l2, l3);
+        __m512i out[4];
+        montgomery_mul_8(a_limbs, b_limbs, modulus_52, out);
+        store_transposed(result + 4 * i, out[0], out[1], out[2], out[3]);
+    }
+    return num_processed;
+}
+
+BBERG_IFMA_TARGET size_t sqr_batch(const uint64_t* a, uint64_t* result, const size_t n, const Modulus& modulus)
+{
+    const Modulus52 modulus_52 = broadcast_modulus(modulus);
+    const size_t num_processed = n - (n % NUM_LANES);
+    for (size_t i = 0; i < num_processed; i += NUM_LANES) {
+        __m512i l0;
+        __m512i l1;
+        __m512i l2;
+        __m512i l3;
+        load_transposed(a + 4 * i, l0, l1, l2, l3);
+        const Limbs52 a_limbs = to_radix_52<0>(l0, l1, l2, l3);
+        const Limbs52 b_limbs = to_radix_52<4>(l0, l1, l2, l3);
+        __m512i out[4];
+        montgomery_mul_8(a_limbs, b_limbs, modulus_52, out);
+        store_transposed(result + 4 * i, out[0], out[1], out[2], out[3]);
+    }
+    return num_processed;
+}
+
+#undef BBERG_IFMA_TARGET
+
+#else
+
+bool cpu_supports_ifma()
+{
+    return false;
+}
+
+size_t mul_batch(const uint64_t*, const uint64_t*, uint64_t*, const size_t, const Modulus&)
+{
+    return 0;
+}
+
+size_t sqr_batch(const uint64_t*, uint64_t*, const size_t, const Modulus&)
+{
+    return 0;
+}
+
+#endif
+
+} // namespace bb::field_ifma
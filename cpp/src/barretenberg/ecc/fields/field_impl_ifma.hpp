@@ -0,0 +1,69 @@
+#pragma once
+/**
+ * @file field_impl_ifma.hpp
+ * @brief Multi-lane Montgomery multiplication kernels over AVX-512 IFMA, backing field::mul_batch, field::sqr_batch
+ * and the interleaved field::batch_invert.
+ *
+ * @details The kernels live in field_impl_ifma.cpp, the only translation unit built with the IFMA intrinsics. On
+ * other targets, or on CPUs without AVX-512 IFMA, they process no elements and the scalar code handles everything.
+ */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace bb::field_ifma {
+
+// The number of elements processed by one call of a kernel
+static constexpr size_t NUM_LANES = 8;
+
+/**
+ * @brief The modulus of a field as 4 64-bit limbs, and -p^{-1} mod 2^64.
+ */
+struct Modulus {
+    std::array<uint64_t, 4> limbs;
+    uint64_t r_inv;
+};
+
+/**
+ * @brief Whether the kernels apply to the field: the modulus must have four limbs and fit in 254 bits.
+ */
+template <class Params> constexpr bool is_supported_modulus()
+{
+    return (Params::modulus_3 < 0x4000000000000000ULL) && (Params::modulus_3 != 0);
+}
+
+template <class Params> constexpr Modulus get_modulus()
+{
+    return { { Params::modulus_0, Params::modulus_1, Params::modulus_2, Params::modulus_3 }, Params::r_inv };
+}
+
+/**
+ * @brief Whether the kernels are built and the CPU we are running on supports them. Checked once.
+ */
+bool cpu_supports_ifma();
+
+/**
+ * @brief Compute result[i] = a[i] * b[i] for the largest multiple of NUM_LANES elements. Each argument points to
+ * elements of 4 64-bit limbs in Montgomery form, the result may alias either input. Returns the number of elements
+ * processed.
+ */
+size_t mul_batch(const uint64_t* a, const uint64_t* b, uint64_t* result, size_t n, const Modulus& modulus);
+
+/**
+ * @brief Compute result[i] = a[i]^2, see mul_batch.
+ */
+size_t sqr_batch(const uint64_t* a, uint64_t* result, size_t n, const Modulus& modulus);
+
+template <class Params> size_t mul_batch(const uint64_t* a, const uint64_t* b, uint64_t* result, const size_t n)
+{
+    static constexpr Modulus modulus = get_modulus<Params>();
+    return mul_batch(a, b, result, n, modulus);
+}
+
+template <class Params> size_t sqr_batch(const uint64_t* a, uint64_t* result, const size_t n)
+{
+    static constexpr Modulus modulus = get_modulus<Params>();
+    return sqr_batch(a, result, n, modulus);
+}
+
+} // namespace bb::field_ifma
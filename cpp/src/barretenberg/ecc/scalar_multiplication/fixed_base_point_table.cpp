@@ -0,0 +1,110 @@
+#include "fixed_base_point_table.hpp"
+#include "./runtime_states.hpp"
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/groups/wnaf.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+namespace {
+/**
+ * Rough number of group operations performed by `pippenger_fixed_base` over `num_points` points (after the
+ * endomorphism split). Every wnaf entry costs one addition, and each pass concatenates 2^{bits_per_bucket} buckets
+ * at a cost of two additions per bucket.
+ */
+size_t get_fixed_base_cost(const size_t num_points, const size_t bits_per_bucket, const size_t num_passes)
+{
+    const size_t num_rounds = WNAF_SIZE(bits_per_bucket + 1);
+    return (num_points * num_rounds) + (num_passes << (bits_per_bucket + 1));
+}
+} // namespace
+
+template <typename Curve>
+fixed_base_point_table<Curve>::fixed_base_point_table(const AffineElement* pippenger_points,
+                                                      const size_t num_initial_points,
+                                                      const size_t max_table_bytes)
+    : num_points(num_initial_points)
+    , max_table_bytes(max_table_bytes)
+    , bits_per_bucket(0)
+    , num_windows(1)
+{
+    using Element = typename Curve::Element;
+    using Fq = typename Curve::BaseField;
+
+    const size_t table_size = num_initial_points * 2;
+    const size_t bytes_per_window = std::max(table_size * sizeof(AffineElement), static_cast<size_t>(1));
+    // point indices in the pippenger point schedule are 32 bits wide, so every table must be addressable with them
+    const size_t max_addressable_windows =
+        static_cast<size_t>(UINT32_MAX) / std::max(table_size, static_cast<size_t>(1));
+    const size_t max_num_windows =
+        std::clamp(max_table_bytes / bytes_per_window, static_cast<size_t>(1), max_addressable_windows);
+
+    // Pick the bucket width that minimises the work done per scalar multiplication. We never go narrower than the
+    // regular pippenger width; wider buckets reduce the number of windows, which also shrinks the table.
+    size_t best_cost = SIZE_MAX;
+    for (size_t bits = get_optimal_bucket_width(num_initial_points); bits <= MAX_BITS_PER_BUCKET; ++bits) {
+        const size_t num_rounds = WNAF_SIZE(bits + 1);
+        const size_t num_passes = (num_rounds + max_num_windows - 1) / max_num_windows;
+        const size_t cost = get_fixed_base_cost(table_size, bits, num_passes);
+        if (cost < best_cost) {
+            best_cost = cost;
+            bits_per_bucket = bits;
+            // spread the rounds evenly over the passes, so that we don't store windows we never use
+            num_windows = (num_rounds + num_passes - 1) / num_passes;
+        }
+    }
+
+    // Allocate some overflow, as pippenger prefetches points from beyond the end of the point schedule. The slab
+    // allocator only guarantees 32-byte alignment, which is not enough for affine elements.
+    const size_t prefetch_overflow = 16 * get_num_cpus_pow2();
+    const size_t table_bytes = (num_windows * table_size + prefetch_overflow) * sizeof(AffineElement);
+    points = std::shared_ptr<AffineElement[]>(
+        static_cast<AffineElement*>(aligned_alloc(alignof(AffineElement), table_bytes)), aligned_free);
+    std::copy(pippenger_points, pippenger_points + table_size, points.get());
+
+    // Each window is obtained by doubling the (non-endomorphism) points of the previous window (bits_per_bucket + 1)
+    // times. The endomorphism images are then recovered with a single multiplication by beta.
+    const Fq beta = Fq::cube_root_of_unity();
+    for (size_t window = 1; window < num_windows; ++window) {
+        const AffineElement* previous = points.get() + ((window - 1) * table_size);
+        AffineElement* current = points.get() + (window * table_size);
+        run_loop_in_parallel(num_initial_points, [&](size_t start, size_t end) {
+            std::vector<Element> temporaries(end - start);
+            for (size_t i = start; i < end; ++i) {
+                Element point(previous[i * 2]);
+                for (size_t j = 0; j < bits_per_bucket + 1; ++j) {
+                    point.self_dbl();
+                }
+                temporaries[i - start] = point;
+            }
+            Element::batch_normalize(temporaries.data(), temporaries.size());
+            for (size_t i = start; i < end; ++i) {
+                const Element& point = temporaries[i - start];
+                current[i * 2] = AffineElement(point.x, point.y);
+                current[i * 2 + 1].x = beta * point.x;
+                current[i * 2 + 1].y = -point.y;
+            }
+        });
+    }
+}
+
+template <typename Curve> size_t fixed_base_point_table<Curve>::get_num_rounds() const
+{
+    return WNAF_SIZE(bits_per_bucket + 1);
+}
+
+template <typename Curve> size_t fixed_base_point_table<Curve>::get_num_passes() const
+{
+    const size_t num_rounds = get_num_rounds();
+    return (num_rounds + num_windows - 1) / num_windows;
+}
+
+template struct fixed_base_point_table<curve::BN254>;
+template struct fixed_base_point_table<curve::Grumpkin>;
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief Precomputed multiples of a fixed set of pippenger points, for use by `pippenger_fixed_base`.
+ *
+ * @details For a bucket width of `c` bits, pippenger's algorithm splits each (endomorphism-reduced) scalar into
+ * R = WNAF_SIZE(c + 1) windows, evaluates one round of bucket accumulation per window, and combines the rounds with
+ * (c + 1) point doublings between each. When the points are fixed (e.g. the monomials of a prover SRS) we can instead
+ * precompute the window multiples
+ *
+ *      T_g[i] = 2^{g * (c + 1)} * P_i,   g = 0, ..., num_windows - 1
+ *
+ * once. A window of weight 2^{g * (c + 1)} is then just a window of weight 1 over the points T_g, so the entries of
+ * every window can be added into one shared set of buckets. The per-round bucket concatenation (~2^{c + 1} point
+ * additions per round) is paid once, the doublings between rounds disappear, and because the concatenation is no
+ * longer multiplied by the number of rounds we can afford a wider bucket width than plain pippenger uses.
+ *
+ * If the memory budget does not allow a table for every window, windows are grouped into passes of `num_windows`
+ * consecutive windows; the passes are combined with doublings as in the regular algorithm.
+ *
+ * Table `g` occupies `points[g * 2 * num_points]` to `points[(g + 1) * 2 * num_points - 1]`, and has the same layout as
+ * a pippenger point table (i.e. each point is followed by its endomorphism image). Table 0 is a copy of the input
+ * point table, so a fixed_base_point_table can also be used with the regular pippenger functions.
+ */
+template <typename Curve> struct fixed_base_point_table {
+    using AffineElement = typename Curve::AffineElement;
+
+    // Default memory budget for the precomputed tables
+    static constexpr size_t DEFAULT_MAX_TABLE_BYTES = 1ULL << 30;
+    // Upper bound on the bucket width, so that per-thread bucket scratch space stays small
+    static constexpr size_t MAX_BITS_PER_BUCKET = 20;
+
+    size_t num_points;
+    size_t max_table_bytes;
+    size_t bits_per_bucket;
+    size_t num_windows;
+    std::shared_ptr<AffineElement[]> points;
+
+    fixed_base_point_table(const AffineElement* pippenger_points,
+                           size_t num_initial_points,
+                           size_t max_table_bytes = DEFAULT_MAX_TABLE_BYTES);
+
+    /**
+     * @brief The number of rounds required to evaluate a scalar multiplication with this table's bucket width
+     */
+    [[nodiscard]] size_t get_num_rounds() const;
+
+    /**
+     * @brief The number of bucket accumulation passes, i.e. the number of times the shared buckets are concatenated
+     */
+    [[nodiscard]] size_t get_num_passes() const;
+};
+
+} // namespace bb::scalar_multiplication
@@ -1,18 +1,25 @@
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <span>
+#include <vector>
 
+#include "./point_table.hpp"
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
 #include "./scalar_multiplication.hpp"
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/ecc/groups/wnaf.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/numeric/bitop/pow.hpp"
 
 // NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays, google-readability-casting)
 
@@ -200,14 +207,34 @@ void compute_wnaf_states(uint64_t* point_schedule,
                          uint64_t* round_counts,
                          const typename Curve::ScalarField* scalars,
                          const size_t num_initial_points)
+{
+    compute_wnaf_states<Curve>(point_schedule,
+                               input_skew_table,
+                               round_counts,
+                               scalars,
+                               num_initial_points,
+                               get_optimal_bucket_width(num_initial_points));
+}
+
+/**
+ * Compute the windowed-non-adjacent-form versions of our scalar multipliers, for a given bucket width.
+ *
+ * @details See above. The schedule contains WNAF_SIZE(bits_per_bucket + 1) rounds of `2 * num_initial_points` entries.
+ **/
+template <typename Curve>
+void compute_wnaf_states(uint64_t* point_schedule,
+                         bool* input_skew_table,
+                         uint64_t* round_counts,
+                         const typename Curve::ScalarField* scalars,
+                         const size_t num_initial_points,
+                         const size_t bits_per_bucket)
 {
     using Fr = typename Curve::ScalarField;
     const size_t num_points = num_initial_points * 2;
     constexpr size_t MAX_NUM_ROUNDS = 256;
     constexpr size_t MAX_NUM_THREADS = 128;
-    const size_t num_rounds = get_num_rounds(num_points);
-    const size_t bits_per_bucket = get_optimal_bucket_width(num_initial_points);
     const size_t wnaf_bits = bits_per_bucket + 1;
+    const size_t num_rounds = WNAF_SIZE(wnaf_bits);
     const size_t num_threads = get_num_cpus_pow2();
     const size_t num_initial_points_per_thread = num_initial_points / num_threads;
     const size_t num_points_per_thread = num_points / num_threads;
@@ -264,12 +291,16 @@ void compute_wnaf_states(uint64_t* point_schedule,
  **/
 void organize_buckets(uint64_t* point_schedule, const size_t num_points)
 {
-    const size_t num_rounds = get_num_rounds(num_points);
+    organize_buckets(point_schedule, num_points, get_optimal_bucket_width(num_points / 2));
+}
+
+void organize_buckets(uint64_t* point_schedule, const size_t num_points, const size_t bits_per_bucket)
+{
+    const size_t num_rounds = WNAF_SIZE(bits_per_bucket + 1);
 
     parallel_for(num_rounds, [&](size_t i) {
-        scalar_multiplication::process_buckets(&point_schedule[i * num_points],
-                                               num_points,
-                                               static_cast<uint32_t>(get_optimal_bucket_width(num_points / 2)) + 1);
+        scalar_multiplication::process_buckets(
+            &point_schedule[i * num_points], num_points, static_cast<uint32_t>(bits_per_bucket) + 1);
     });
 }
 
@@ -737,6 +768,81 @@ uint32_t construct_addition_chains(affine_product_runtime_state<Curve>& state, b
     return max_bucket_bits;
 }
 
+/**
+ * Adds a bucket-sorted slice of a point schedule into its buckets, and concatenates the buckets.
+ *
+ * If the slice covers buckets [first_bucket, last_bucket], and B_k is the sum of the points assigned to bucket k, the
+ * result is \sum_k (2k + 1) * B_k (bucket k represents the odd wnaf digit 2k + 1).
+ * Because the result is linear in the buckets, a round can be split into any number of slices (even if a bucket is
+ * shared between two slices), and the results of the slices summed.
+ *
+ * `product_state` must be a thread's affine product runtime state; it must have room for `num_slice_points` points and
+ * (last_bucket - first_bucket + 1) buckets.
+ **/
+template <typename Curve>
+typename Curve::Element evaluate_bucket_slice(affine_product_runtime_state<Curve>& product_state,
+                                              typename Curve::AffineElement* points,
+                                              uint64_t* point_schedule,
+                                              const size_t num_slice_points,
+                                              bool handle_edge_cases)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    Element accumulator;
+    accumulator.self_set_infinity();
+
+    const size_t first_bucket = point_schedule[0] & 0x7fffffffU;
+    const size_t last_bucket = point_schedule[num_slice_points - 1] & 0x7fffffffU;
+    const size_t num_slice_buckets = (last_bucket - first_bucket) + 1;
+
+    product_state.num_points = static_cast<uint32_t>(num_slice_points);
+    product_state.points = points;
+    product_state.point_schedule = point_schedule;
+    product_state.num_buckets = static_cast<uint32_t>(num_slice_buckets);
+    AffineElement* output_buckets = reduce_buckets(product_state, true, handle_edge_cases);
+    Element running_sum;
+    running_sum.self_set_infinity();
+
+    // one nice side-effect of the affine trick, is that half of the bucket concatenation
+    // algorithm can use mixed addition formulae, instead of full addition formulae
+    size_t output_it = product_state.num_points - 1;
+    for (size_t k = num_slice_buckets - 1; k > 0; --k) {
+        if (__builtin_expect(!product_state.bucket_empty_status[k], 1)) {
+            running_sum += (output_buckets[output_it]);
+            --output_it;
+        }
+        accumulator += running_sum;
+    }
+    running_sum += output_buckets[0];
+    accumulator.self_dbl();
+    accumulator += running_sum;
+
+    // we now need to scale up 'running sum' up to the value of the first bucket.
+    // e.g. if first bucket is 0, no scaling
+    // if first bucket is 1, we need to add (2 * running_sum)
+    if (first_bucket > 0) {
+        auto multiplier = static_cast<uint32_t>(first_bucket << 1UL);
+        size_t shift = numeric::get_msb(multiplier);
+        Element rolling_accumulator = Curve::Group::point_at_infinity;
+        bool init = false;
+        while (shift != static_cast<size_t>(-1)) {
+            if (init) {
+                rolling_accumulator.self_dbl();
+                if (((multiplier >> shift) & 1)) {
+                    rolling_accumulator += running_sum;
+                }
+            } else {
+                rolling_accumulator += running_sum;
+            }
+            init = true;
+            shift -= 1;
+        }
+        accumulator += rolling_accumulator;
+    }
+    return accumulator;
+}
+
 template <typename Curve>
 typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>& state,
                                                   typename Curve::AffineElement* points,
@@ -771,57 +877,14 @@ typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>
 
                 uint64_t* thread_point_schedule =
                     &state.point_schedule[(i * num_points) + j * num_round_points_per_thread];
-                const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
-                const size_t last_bucket =
-                    thread_point_schedule[(num_round_points_per_thread - 1 + leftovers)] & 0x7fffffffU;
-                const size_t num_thread_buckets = (last_bucket - first_bucket) + 1;
 
                 affine_product_runtime_state<Curve> product_state =
                     state.get_affine_product_runtime_state(num_threads, j);
-                product_state.num_points = static_cast<uint32_t>(num_round_points_per_thread + leftovers);
-                product_state.points = points;
-                product_state.point_schedule = thread_point_schedule;
-                product_state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
-                AffineElement* output_buckets = reduce_buckets(product_state, true, handle_edge_cases);
-                Element running_sum;
-                running_sum.self_set_infinity();
-
-                // one nice side-effect of the affine trick, is that half of the bucket concatenation
-                // algorithm can use mixed addition formulae, instead of full addition formulae
-                size_t output_it = product_state.num_points - 1;
-                for (size_t k = num_thread_buckets - 1; k > 0; --k) {
-                    if (__builtin_expect(!product_state.bucket_empty_status[k], 1)) {
-                        running_sum += (output_buckets[output_it]);
-                        --output_it;
-                    }
-                    accumulator += running_sum;
-                }
-                running_sum += output_buckets[0];
-                accumulator.self_dbl();
-                accumulator += running_sum;
-
-                // we now need to scale up 'running sum' up to the value of the first bucket.
-                // e.g. if first bucket is 0, no scaling
-                // if first bucket is 1, we need to add (2 * running_sum)
-                if (first_bucket > 0) {
-                    auto multiplier = static_cast<uint32_t>(first_bucket << 1UL);
-                    size_t shift = numeric::get_msb(multiplier);
-                    Element rolling_accumulator = Curve::Group::point_at_infinity;
-                    bool init = false;
-                    while (shift != static_cast<size_t>(-1)) {
-                        if (init) {
-                            rolling_accumulator.self_dbl();
-                            if (((multiplier >> shift) & 1)) {
-                                rolling_accumulator += running_sum;
-                            }
-                        } else {
-                            rolling_accumulator += running_sum;
-                        }
-                        init = true;
-                        shift -= 1;
-                    }
-                    accumulator += rolling_accumulator;
-                }
+                accumulator = evaluate_bucket_slice(product_state,
+                                                    points,
+                                                    thread_point_schedule,
+                                                    static_cast<size_t>(num_round_points_per_thread + leftovers),
+                                                    handle_edge_cases);
             }
 
             if (i == (num_rounds - 1)) {
@@ -955,8 +1018,492 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(typename Cur
     return pippenger(scalars, &G_mod[0], num_initial_points, state, false);
 }
 
+/**
+ * Pippenger for scalar vectors that are mostly zero (e.g. selectors, or columns that are only populated in a few rows).
+ *
+ * Zero scalars never contribute a bucket entry, but pippenger still pays for them: the wnaf states, the sorting of
+ * every round, and (most importantly) a bucket width and round count tuned for `num_initial_points` rather than for
+ * the number of terms that are actually present. If at least half of the scalars are zero, we compact the non-zero
+ * scalars and their pippenger points (point and endomorphism pair) into a dense MSM first.
+ *
+ * Short scalars need no special handling: `fixed_wnaf_with_counts` only emits entries for the windows a scalar
+ * actually occupies, and rounds without entries are skipped, so they only cost bucket additions in their low rounds.
+ **/
+template <typename Curve>
+typename Curve::Element pippenger_sparse(typename Curve::ScalarField* scalars,
+                                         typename Curve::AffineElement* points,
+                                         const size_t num_initial_points,
+                                         pippenger_runtime_state<Curve>& state,
+                                         bool handle_edge_cases)
+{
+    using Fr = typename Curve::ScalarField;
+    using AffineElement = typename Curve::AffineElement;
+
+    const size_t num_threads = get_num_cpus_pow2();
+    std::vector<size_t> thread_offsets(num_threads + 1, 0);
+    parallel_for(num_threads, [&](size_t j) {
+        const size_t start = (j * num_initial_points) / num_threads;
+        const size_t end = ((j + 1) * num_initial_points) / num_threads;
+        size_t count = 0;
+        for (size_t i = start; i < end; ++i) {
+            count += static_cast<size_t>(!scalars[i].is_zero());
+        }
+        thread_offsets[j + 1] = count;
+    });
+    for (size_t j = 0; j < num_threads; ++j) {
+        thread_offsets[j + 1] += thread_offsets[j];
+    }
+    const size_t num_nonzero_scalars = thread_offsets[num_threads];
+
+    if (num_nonzero_scalars > num_initial_points / 2) {
+        return pippenger(scalars, points, num_initial_points, state, handle_edge_cases);
+    }
+
+    std::vector<Fr> compact_scalars(num_nonzero_scalars);
+    // point_table_alloc only guarantees 32-byte alignment, which is not enough for affine elements
+    std::shared_ptr<AffineElement[]> compact_points(
+        static_cast<AffineElement*>(aligned_alloc(alignof(AffineElement), point_table_buf_size(num_nonzero_scalars))),
+        aligned_free);
+    parallel_for(num_threads, [&](size_t j) {
+        const size_t start = (j * num_initial_points) / num_threads;
+        const size_t end = ((j + 1) * num_initial_points) / num_threads;
+        size_t offset = thread_offsets[j];
+        for (size_t i = start; i < end; ++i) {
+            if (!scalars[i].is_zero()) {
+                compact_scalars[offset] = scalars[i];
+                compact_points[offset * 2] = points[i * 2];
+                compact_points[offset * 2 + 1] = points[i * 2 + 1];
+                ++offset;
+            }
+        }
+    });
+    return pippenger(compact_scalars.data(), compact_points.get(), num_nonzero_scalars, state, handle_edge_cases);
+}
+
+template <typename Curve>
+typename Curve::Element pippenger_sparse_unsafe(typename Curve::ScalarField* scalars,
+                                                typename Curve::AffineElement* points,
+                                                const size_t num_initial_points,
+                                                pippenger_runtime_state<Curve>& state)
+{
+    return pippenger_sparse(scalars, points, num_initial_points, state, false);
+}
+
+/**
+ * Evaluates a scalar multiplication over `2 * num_initial_points` pippenger points using a fixed_base_point_table.
+ *
+ * `points` must point into the first window of `table`; the scalar windows are computed with the table's bucket width,
+ * and each entry of the point schedule is redirected to the window table that matches its weight. The entries of all
+ * rounds in a pass are then added into one shared set of buckets, so we only perform one bucket concatenation per pass
+ * (rather than one per round), and only double between passes.
+ *
+ * To keep the merged rounds within the (per-round sized) scratch space of `state`, each thread merges the sorted
+ * rounds of its bucket range into slices and evaluates the slices one at a time, see `evaluate_bucket_slice`.
+ **/
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base_internal(typename Curve::AffineElement* points,
+                                                      typename Curve::ScalarField* scalars,
+                                                      const size_t num_initial_points,
+                                                      const fixed_base_point_table<Curve>& table,
+                                                      pippenger_runtime_state<Curve>& state,
+                                                      bool handle_edge_cases)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    const size_t num_points = num_initial_points * 2;
+    const size_t bits_per_bucket = table.bits_per_bucket;
+    const size_t num_buckets = 1UL << bits_per_bucket;
+    const size_t num_rounds = table.get_num_rounds();
+    const size_t num_windows = table.num_windows;
+    const size_t num_passes = table.get_num_passes();
+    const size_t table_size = table.num_points * 2;
+    const size_t num_threads = get_num_cpus_pow2();
+
+    compute_wnaf_states<Curve>(
+        state.point_schedule, state.skew_table, state.round_counts, scalars, num_initial_points, bits_per_bucket);
+    organize_buckets(state.point_schedule, num_points, bits_per_bucket);
+
+    // Round i (most significant first) has weight 2^{(num_rounds - 1 - i) * (bits_per_bucket + 1)}. It is evaluated in
+    // pass (num_rounds - 1 - i) / num_windows, using the window that absorbs the remainder of its weight.
+    parallel_for(num_rounds, [&](size_t i) {
+        const uint64_t window = (num_rounds - 1 - i) % num_windows;
+        const uint64_t window_offset = static_cast<uint64_t>(window * table_size) << 32ULL;
+        uint64_t* round_schedule = &state.point_schedule[i * num_points];
+        for (size_t k = 0; k < state.round_counts[i]; ++k) {
+            round_schedule[k] += window_offset;
+        }
+    });
+
+    // the number of points in a slice is bounded by the per-thread scratch space of the runtime state
+    const auto max_slice_points = static_cast<size_t>(state.num_points / num_threads);
+
+    std::unique_ptr<Element[], decltype(&aligned_free)> thread_accumulators(
+        static_cast<Element*>(aligned_alloc(64, num_threads * sizeof(Element))), &aligned_free);
+
+    parallel_for(num_threads, [&](size_t j) {
+        thread_accumulators[j].self_set_infinity();
+
+        const size_t first_thread_bucket = (j * num_buckets) / num_threads;
+        const size_t end_thread_bucket = ((j + 1) * num_buckets) / num_threads;
+        const size_t num_thread_buckets = end_thread_bucket - first_thread_bucket;
+
+        // The table's bucket width can exceed the one the runtime state was sized for, so the bucket scratch space
+        // is allocated here. reduce_buckets prefetches points from up to 32 entries beyond the end of the slice.
+        std::vector<uint64_t> slice_schedule(max_slice_points + 32, 0);
+        std::vector<uint32_t> bucket_counts(num_thread_buckets);
+        std::array<uint32_t, 32> bit_offsets{};
+        std::unique_ptr<bool[]> bucket_empty_status(new bool[num_thread_buckets]);
+        std::vector<const uint64_t*> round_iterators(num_windows);
+        std::vector<const uint64_t*> round_ends(num_windows);
+        const auto bucket_less = [](const uint64_t entry, const size_t bucket) {
+            return static_cast<size_t>(entry & 0x7fffffffU) < bucket;
+        };
+
+        for (size_t pass = num_passes - 1; pass < num_passes; --pass) {
+            const size_t end_round = num_rounds - pass * num_windows;
+            const size_t first_round = (end_round > num_windows) ? end_round - num_windows : 0;
+            const size_t num_pass_rounds = end_round - first_round;
+            for (size_t i = 0; i < num_pass_rounds; ++i) {
+                const uint64_t* round_schedule = &state.point_schedule[(first_round + i) * num_points];
+                const uint64_t* round_end = round_schedule + state.round_counts[first_round + i];
+                round_iterators[i] = std::lower_bound(round_schedule, round_end, first_thread_bucket, bucket_less);
+                round_ends[i] = std::lower_bound(round_iterators[i], round_end, end_thread_bucket, bucket_less);
+            }
+
+            Element pass_accumulator;
+            pass_accumulator.self_set_infinity();
+            size_t num_slice_points = 0;
+            const auto evaluate_slice = [&]() {
+                if (num_slice_points > 0) {
+                    affine_product_runtime_state<Curve> product_state =
+                        state.get_affine_product_runtime_state(num_threads, j);
+                    product_state.bucket_counts = &bucket_counts[0];
+                    product_state.bit_offsets = &bit_offsets[0];
+                    product_state.bucket_empty_status = &bucket_empty_status[0];
+                    pass_accumulator += evaluate_bucket_slice(
+                        product_state, points, &slice_schedule[0], num_slice_points, handle_edge_cases);
+                    num_slice_points = 0;
+                }
+            };
+
+            // merge the (bucket-sorted) rounds of this pass into bucket-sorted slices
+            for (size_t bucket = first_thread_bucket; bucket < end_thread_bucket; ++bucket) {
+                for (size_t i = 0; i < num_pass_rounds; ++i) {
+                    const uint64_t*& it = round_iterators[i];
+                    while (it != round_ends[i] && static_cast<size_t>(*it & 0x7fffffffU) == bucket) {
+                        if (num_slice_points == max_slice_points) {
+                            evaluate_slice();
+                        }
+                        slice_schedule[num_slice_points++] = *it;
+                        ++it;
+                    }
+                }
+            }
+            evaluate_slice();
+
+            if (pass != num_passes - 1) {
+                for (size_t k = 0; k < num_windows * (bits_per_bucket + 1); ++k) {
+                    thread_accumulators[j].self_dbl();
+                }
+            }
+            thread_accumulators[j] += pass_accumulator;
+        }
+
+        // the skew has weight 1, so it is removed using the points of the first window
+        const size_t num_points_per_thread = num_points / num_threads;
+        bool* skew_table = &state.skew_table[j * num_points_per_thread];
+        AffineElement* point_table = &points[j * num_points_per_thread];
+        AffineElement addition_temporary;
+        for (size_t k = 0; k < num_points_per_thread; ++k) {
+            if (skew_table[k]) {
+                addition_temporary = -point_table[k];
+                thread_accumulators[j] += addition_temporary;
+            }
+        }
+    });
+
+    Element result;
+    result.self_set_infinity();
+    for (size_t i = 0; i < num_threads; ++i) {
+        result += thread_accumulators[i];
+    }
+    return result;
+}
+
+/**
+ * Pippenger over the fixed set of points described by `table`, see `fixed_base_point_table`.
+ *
+ * Like `pippenger`, the input is split into power-of-two slices. Slices that are small compared to the table (whose
+ * bucket width is tuned for `table.num_points`) are evaluated with regular pippenger, over the first window.
+ **/
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base(typename Curve::ScalarField* scalars,
+                                             const fixed_base_point_table<Curve>& table,
+                                             const size_t num_initial_points,
+                                             pippenger_runtime_state<Curve>& state,
+                                             bool handle_edge_cases)
+{
+    using Element = typename Curve::Element;
+    ASSERT(num_initial_points <= table.num_points);
+
+    // see `pippenger` for the choice of threshold
+    const size_t threshold = get_num_cpus_pow2() * 8;
+    typename Curve::AffineElement* points = table.points.get();
+
+    Element result;
+    result.self_set_infinity();
+
+    size_t offset = 0;
+    while (num_initial_points - offset > threshold) {
+        const auto slice_bits =
+            static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_initial_points - offset)));
+        const auto num_slice_points = static_cast<size_t>(1ULL << slice_bits);
+        const size_t num_points = num_slice_points * 2;
+
+        const size_t fixed_base_cost =
+            (num_points * table.get_num_rounds()) + (table.get_num_passes() << (table.bits_per_bucket + 1));
+        const size_t regular_cost =
+            get_num_rounds(num_points) * (num_points + (2UL << get_optimal_bucket_width(num_slice_points)));
+        if (fixed_base_cost <= regular_cost) {
+            result += pippenger_fixed_base_internal(
+                points + offset * 2, scalars + offset, num_slice_points, table, state, handle_edge_cases);
+        } else {
+            result +=
+                pippenger_internal(points + offset * 2, scalars + offset, num_slice_points, state, handle_edge_cases);
+        }
+        offset += num_slice_points;
+    }
+
+    const size_t num_leftover_points = num_initial_points - offset;
+    if (num_leftover_points > 0) {
+        std::vector<Element> exponentiation_results(num_leftover_points);
+        parallel_for(num_leftover_points, [&](size_t i) {
+            exponentiation_results[i] = Element(points[(offset + i) * 2]) * scalars[offset + i];
+        });
+        for (const Element& exponentiation_result : exponentiation_results) {
+            result += exponentiation_result;
+        }
+    }
+    return result;
+}
+
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base_unsafe(typename Curve::ScalarField* scalars,
+                                                    const fixed_base_point_table<Curve>& table,
+                                                    const size_t num_initial_points,
+                                                    pippenger_runtime_state<Curve>& state)
+{
+    return pippenger_fixed_base(scalars, table, num_initial_points, state, false);
+}
+
+/**
+ * Evaluates a batch of scalar multiplications over the same `2 * num_initial_points` pippenger points.
+ *
+ * The wnaf states of every scalar vector are computed and bucket-sorted up front. Each round is then evaluated for the
+ * whole batch in a single parallel region: the threads split the concatenation of the round's point schedules evenly
+ * between them, so we synchronize once per round (rather than once per round per scalar vector), and the sparse rounds
+ * of one scalar vector don't leave threads idle.
+ *
+ * The point schedules of the batch (one regular point schedule per scalar vector) are allocated here. `state` only
+ * provides the per-thread scratch space, and must have been constructed for at least `num_initial_points` points.
+ **/
+template <typename Curve>
+void pippenger_batch_internal(typename Curve::AffineElement* points,
+                              std::span<const typename Curve::ScalarField* const> scalars,
+                              const size_t num_initial_points,
+                              pippenger_runtime_state<Curve>& state,
+                              typename Curve::Element* results,
+                              bool handle_edge_cases)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    const size_t num_polynomials = scalars.size();
+    const size_t num_points = num_initial_points * 2;
+    const size_t bits_per_bucket = get_optimal_bucket_width(num_initial_points);
+    const size_t num_rounds = WNAF_SIZE(bits_per_bucket + 1);
+    const size_t num_threads = get_num_cpus_pow2();
+    const size_t schedule_size = num_points * num_rounds;
+    ASSERT(state.num_points >= num_points);
+
+    std::shared_ptr<void> point_schedule_ptr =
+        get_mem_slab((num_polynomials * schedule_size + state.prefetch_overflow) * sizeof(uint64_t));
+    auto* point_schedule = static_cast<uint64_t*>(point_schedule_ptr.get());
+    std::unique_ptr<bool[]> skew_table(new bool[num_polynomials * num_points]);
+    std::vector<uint64_t> round_counts(num_polynomials * num_rounds);
+
+    for (size_t k = 0; k < num_polynomials; ++k) {
+        compute_wnaf_states<Curve>(&point_schedule[k * schedule_size],
+                                   &skew_table[k * num_points],
+                                   &round_counts[k * num_rounds],
+                                   scalars[k],
+                                   num_initial_points,
+                                   bits_per_bucket);
+    }
+    // the round schedules of the batch are stored back to back, so we can sort them all in one go
+    parallel_for(num_polynomials * num_rounds, [&](size_t i) {
+        scalar_multiplication::process_buckets(
+            &point_schedule[i * num_points], num_points, static_cast<uint32_t>(bits_per_bucket) + 1);
+    });
+
+    // the number of points in a slice is bounded by the per-thread scratch space of the runtime state
+    const auto max_slice_points = static_cast<size_t>(state.num_points / num_threads);
+
+    std::vector<Element> thread_accumulators(num_threads * num_polynomials);
+
+    parallel_for(num_threads, [&](size_t j) {
+        Element* accumulators = &thread_accumulators[j * num_polynomials];
+        for (size_t k = 0; k < num_polynomials; ++k) {
+            accumulators[k].self_set_infinity();
+        }
+
+        for (size_t i = 0; i < num_rounds; ++i) {
+            if (i > 0) {
+                for (size_t k = 0; k < num_polynomials; ++k) {
+                    for (size_t l = 0; l < bits_per_bucket + 1; ++l) {
+                        accumulators[k].self_dbl();
+                    }
+                }
+            }
+
+            uint64_t num_round_points = 0;
+            for (size_t k = 0; k < num_polynomials; ++k) {
+                num_round_points += round_counts[k * num_rounds + i];
+            }
+            uint64_t start = (j * num_round_points) / num_threads;
+            const uint64_t end = ((j + 1) * num_round_points) / num_threads;
+
+            // `offset` is the position of the k'th round schedule in the concatenation
+            uint64_t offset = 0;
+            for (size_t k = 0; k < num_polynomials && start < end; ++k) {
+                const uint64_t num_polynomial_points = round_counts[k * num_rounds + i];
+                const uint64_t polynomial_end = std::min(end, offset + num_polynomial_points);
+                uint64_t* round_schedule = &point_schedule[(k * num_rounds + i) * num_points];
+                while (start < polynomial_end) {
+                    const auto num_slice_points = static_cast<size_t>(std::min(
+                        polynomial_end - start, static_cast<uint64_t>(max_slice_points)));
+                    affine_product_runtime_state<Curve> product_state =
+                        state.get_affine_product_runtime_state(num_threads, j);
+                    accumulators[k] += evaluate_bucket_slice(
+                        product_state, points, &round_schedule[start - offset], num_slice_points, handle_edge_cases);
+                    start += num_slice_points;
+                }
+                offset += num_polynomial_points;
+            }
+        }
+
+        const size_t num_points_per_thread = num_points / num_threads;
+        AffineElement* point_table = &points[j * num_points_per_thread];
+        AffineElement addition_temporary;
+        for (size_t k = 0; k < num_polynomials; ++k) {
+            const bool* polynomial_skew_table = &skew_table[k * num_points + j * num_points_per_thread];
+            for (size_t l = 0; l < num_points_per_thread; ++l) {
+                if (polynomial_skew_table[l]) {
+                    addition_temporary = -point_table[l];
+                    accumulators[k] += addition_temporary;
+                }
+            }
+        }
+    });
+
+    for (size_t k = 0; k < num_polynomials; ++k) {
+        for (size_t j = 0; j < num_threads; ++j) {
+            results[k] += thread_accumulators[j * num_polynomials + k];
+        }
+    }
+}
+
+/**
+ * Pippenger over a batch of scalar vectors that share the same points, e.g. several polynomials committed to with
+ * the same SRS. Returns one result per scalar vector.
+ *
+ * The points are consumed in power of two chunks of at most `max_chunk_points` points, and every scalar vector of the
+ * batch is bucketed against a chunk (see `pippenger_batch_internal`) before we move on to the next one. The points of a
+ * chunk are therefore the working set of every round of every MSM in the batch: they are read from memory once per
+ * chunk, rather than once per round per scalar vector. The point schedules also only need to cover a single chunk.
+ *
+ * The default chunk size, PIPPENGER_BATCH_CHUNK_POINTS, is the smallest chunk that still gets the bucket width of a
+ * full size MSM (see `get_optimal_bucket_width`), so chunking does not add rounds. Each chunk does pay for its own
+ * bucket concatenation.
+ **/
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch(std::span<const typename Curve::ScalarField* const> scalars,
+                                                     typename Curve::AffineElement* points,
+                                                     const size_t num_initial_points,
+                                                     pippenger_runtime_state<Curve>& state,
+                                                     bool handle_edge_cases,
+                                                     const size_t max_chunk_points)
+{
+    using Element = typename Curve::Element;
+    using Fr = typename Curve::ScalarField;
+    const size_t num_polynomials = scalars.size();
+    ASSERT(numeric::is_power_of_two(max_chunk_points));
+
+    std::vector<Element> results(num_polynomials);
+    for (Element& result : results) {
+        result.self_set_infinity();
+    }
+
+    // see `pippenger` for the choice of threshold
+    const size_t threshold = get_num_cpus_pow2() * 8;
+
+    if (num_initial_points <= threshold || num_polynomials == 1) {
+        for (size_t k = 0; k < num_polynomials; ++k) {
+            results[k] =
+                pippenger(const_cast<Fr*>(scalars[k]), points, num_initial_points, state, handle_edge_cases);
+        }
+        return results;
+    }
+
+    std::vector<const Fr*> chunk_scalars(num_polynomials);
+    size_t offset = 0;
+    while (num_initial_points - offset > threshold) {
+        const auto slice_bits =
+            static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_initial_points - offset)));
+        const size_t num_chunk_points = std::min(static_cast<size_t>(1ULL << slice_bits), max_chunk_points);
+        for (size_t k = 0; k < num_polynomials; ++k) {
+            chunk_scalars[k] = scalars[k] + offset;
+        }
+        pippenger_batch_internal(
+            points + offset * 2, chunk_scalars, num_chunk_points, state, &results[0], handle_edge_cases);
+        offset += num_chunk_points;
+    }
+
+    if (offset != num_initial_points) {
+        for (size_t k = 0; k < num_polynomials; ++k) {
+            results[k] += pippenger(const_cast<Fr*>(scalars[k]) + offset,
+                                    points + offset * 2,
+                                    num_initial_points - offset,
+                                    state,
+                                    handle_edge_cases);
+        }
+    }
+    return results;
+}
+
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch_unsafe(std::span<const typename Curve::ScalarField* const> scalars,
+                                                            typename Curve::AffineElement* points,
+                                                            const size_t num_initial_points,
+                                                            pippenger_runtime_state<Curve>& state)
+{
+    return pippenger_batch(scalars, points, num_initial_points, state, false);
+}
+
 // Explicit instantiation
 // BN254
+template void compute_wnaf_states<curve::BN254>(uint64_t* point_schedule,
+                                                bool* input_skew_table,
+                                                uint64_t* round_counts,
+                                                const curve::BN254::ScalarField* scalars,
+                                                const size_t num_initial_points);
+
+template void compute_wnaf_states<curve::BN254>(uint64_t* point_schedule,
+                                                bool* input_skew_table,
+                                                uint64_t* round_counts,
+                                                const curve::BN254::ScalarField* scalars,
+                                                const size_t num_initial_points,
+                                                const size_t bits_per_bucket);
+
 template void generate_pippenger_point_table<curve::BN254>(curve::BN254::AffineElement* points,
                                                            curve::BN254::AffineElement* table,
                                                            size_t num_points);
@@ -1007,7 +1554,57 @@ template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve
     const size_t num_initial_points,
     pippenger_runtime_state<curve::BN254>& state);
 
+template curve::BN254::Element pippenger_sparse<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                              curve::BN254::AffineElement* points,
+                                                              const size_t num_initial_points,
+                                                              pippenger_runtime_state<curve::BN254>& state,
+                                                              bool handle_edge_cases = true);
+
+template curve::BN254::Element pippenger_sparse_unsafe<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                                     curve::BN254::AffineElement* points,
+                                                                     const size_t num_initial_points,
+                                                                     pippenger_runtime_state<curve::BN254>& state);
+
+template curve::BN254::Element pippenger_fixed_base<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                                  const fixed_base_point_table<curve::BN254>& table,
+                                                                  const size_t num_initial_points,
+                                                                  pippenger_runtime_state<curve::BN254>& state,
+                                                                  bool handle_edge_cases = true);
+
+template curve::BN254::Element pippenger_fixed_base_unsafe<curve::BN254>(
+    curve::BN254::ScalarField* scalars,
+    const fixed_base_point_table<curve::BN254>& table,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state);
+
+template std::vector<curve::BN254::Element> pippenger_batch<curve::BN254>(
+    std::span<const curve::BN254::ScalarField* const> scalars,
+    curve::BN254::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state,
+    bool handle_edge_cases = true,
+    const size_t max_chunk_points = PIPPENGER_BATCH_CHUNK_POINTS);
+
+template std::vector<curve::BN254::Element> pippenger_batch_unsafe<curve::BN254>(
+    std::span<const curve::BN254::ScalarField* const> scalars,
+    curve::BN254::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state);
+
 // Grumpkin
+template void compute_wnaf_states<curve::Grumpkin>(uint64_t* point_schedule,
+                                                   bool* input_skew_table,
+                                                   uint64_t* round_counts,
+                                                   const curve::Grumpkin::ScalarField* scalars,
+                                                   const size_t num_initial_points);
+
+template void compute_wnaf_states<curve::Grumpkin>(uint64_t* point_schedule,
+                                                   bool* input_skew_table,
+                                                   uint64_t* round_counts,
+                                                   const curve::Grumpkin::ScalarField* scalars,
+                                                   const size_t num_initial_points,
+                                                   const size_t bits_per_bucket);
+
 template void generate_pippenger_point_table<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
                                                               curve::Grumpkin::AffineElement* table,
                                                               size_t num_points);
@@ -1058,6 +1655,45 @@ template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<cu
     const size_t num_initial_points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template curve::Grumpkin::Element pippenger_sparse<curve::Grumpkin>(curve::Grumpkin::ScalarField* scalars,
+                                                                    curve::Grumpkin::AffineElement* points,
+                                                                    const size_t num_initial_points,
+                                                                    pippenger_runtime_state<curve::Grumpkin>& state,
+                                                                    bool handle_edge_cases = true);
+
+template curve::Grumpkin::Element pippenger_sparse_unsafe<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
+template curve::Grumpkin::Element pippenger_fixed_base<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    const fixed_base_point_table<curve::Grumpkin>& table,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    bool handle_edge_cases = true);
+
+template curve::Grumpkin::Element pippenger_fixed_base_unsafe<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    const fixed_base_point_table<curve::Grumpkin>& table,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
+template std::vector<curve::Grumpkin::Element> pippenger_batch<curve::Grumpkin>(
+    std::span<const curve::Grumpkin::ScalarField* const> scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    bool handle_edge_cases = true,
+    const size_t max_chunk_points = PIPPENGER_BATCH_CHUNK_POINTS);
+
+template std::vector<curve::Grumpkin::Element> pippenger_batch_unsafe<curve::Grumpkin>(
+    std::span<const curve::Grumpkin::ScalarField* const> scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
 } // namespace bb::scalar_multiplication
 
 // NOLINTEND(cppcoreguidelines-avoid-c-arrays, google-readability-casting)
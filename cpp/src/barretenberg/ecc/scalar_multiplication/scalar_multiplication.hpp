@@ -1,10 +1,13 @@
 #pragma once
 
+#include "./fixed_base_point_table.hpp"
 #include "./runtime_states.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 namespace bb::scalar_multiplication {
 
@@ -92,12 +95,21 @@ void compute_wnaf_states(uint64_t* point_schedule,
                          const typename Curve::ScalarField* scalars,
                          size_t num_initial_points);
 
+template <typename Curve>
+void compute_wnaf_states(uint64_t* point_schedule,
+                         bool* input_skew_table,
+                         uint64_t* round_counts,
+                         const typename Curve::ScalarField* scalars,
+                         size_t num_initial_points,
+                         size_t bits_per_bucket);
+
 template <typename Curve>
 void generate_pippenger_point_table(typename Curve::AffineElement* points,
                                     typename Curve::AffineElement* table,
                                     size_t num_points);
 
 void organize_buckets(uint64_t* point_schedule, size_t num_points);
+void organize_buckets(uint64_t* point_schedule, size_t num_points, size_t bits_per_bucket);
 
 inline void count_bits(const uint32_t* bucket_counts,
                        uint32_t* bit_offsets,
@@ -170,6 +182,49 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(typename Cur
                                                                     size_t num_initial_points,
                                                                     pippenger_runtime_state<Curve>& state);
 
+template <typename Curve>
+typename Curve::Element pippenger_sparse(typename Curve::ScalarField* scalars,
+                                         typename Curve::AffineElement* points,
+                                         size_t num_initial_points,
+                                         pippenger_runtime_state<Curve>& state,
+                                         bool handle_edge_cases = true);
+
+template <typename Curve>
+typename Curve::Element pippenger_sparse_unsafe(typename Curve::ScalarField* scalars,
+                                                typename Curve::AffineElement* points,
+                                                size_t num_initial_points,
+                                                pippenger_runtime_state<Curve>& state);
+
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base(typename Curve::ScalarField* scalars,
+                                             const fixed_base_point_table<Curve>& table,
+                                             size_t num_initial_points,
+                                             pippenger_runtime_state<Curve>& state,
+                                             bool handle_edge_cases = true);
+
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base_unsafe(typename Curve::ScalarField* scalars,
+                                                    const fixed_base_point_table<Curve>& table,
+                                                    size_t num_initial_points,
+                                                    pippenger_runtime_state<Curve>& state);
+
+// the number of points a batched pippenger buckets every scalar vector of the batch against at a time
+constexpr size_t PIPPENGER_BATCH_CHUNK_POINTS = 1UL << 18;
+
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch(std::span<const typename Curve::ScalarField* const> scalars,
+                                                     typename Curve::AffineElement* points,
+                                                     size_t num_initial_points,
+                                                     pippenger_runtime_state<Curve>& state,
+                                                     bool handle_edge_cases = true,
+                                                     size_t max_chunk_points = PIPPENGER_BATCH_CHUNK_POINTS);
+
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch_unsafe(std::span<const typename Curve::ScalarField* const> scalars,
+                                                            typename Curve::AffineElement* points,
+                                                            size_t num_initial_points,
+                                                            pippenger_runtime_state<Curve>& state);
+
 // Explicit instantiation
 // BN254
 
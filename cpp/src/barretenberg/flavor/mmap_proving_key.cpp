@@ -0,0 +1,119 @@
+#include "mmap_proving_key.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/mapped_file.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/flavor/goblin_ultra.hpp"
+#include "barretenberg/flavor/ultra.hpp"
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+namespace bb::honk::flavor {
+
+template <typename Flavor> void write_mmap_proving_key(std::string const& path, typename Flavor::ProvingKey& key)
+{
+    using serialize::write;
+    using FF = typename Flavor::FF;
+
+    uint64_t num_ecc_op_gates = 0;
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        num_ecc_op_gates = key.num_ecc_op_gates;
+    }
+
+    auto polys = key.get_precomputed_polynomials();
+    const auto labels = key.get_precomputed_labels();
+    std::vector<uint8_t> metadata;
+    // circuit_type is not set on keys computed from a circuit, the flavor determines it
+    write(metadata, static_cast<uint32_t>(Flavor::CircuitBuilder::CIRCUIT_TYPE));
+    write(metadata, static_cast<uint64_t>(key.circuit_size));
+    write(metadata, static_cast<uint64_t>(key.num_public_inputs));
+    write(metadata, key.contains_recursive_proof);
+    write(metadata, key.recursive_proof_public_input_indices);
+    write(metadata, num_ecc_op_gates);
+    write(metadata, static_cast<uint32_t>(polys.size()));
+    std::vector<MappedSection> sections;
+    uint64_t offset = 0;
+    for (size_t i = 0; i < polys.size(); ++i) {
+        write(metadata, labels[i]);
+        write(metadata, offset);
+        write(metadata, static_cast<uint64_t>(polys[i].size()));
+        // A polynomial over the mapping must have room for its shifted coefficients, like any other
+        const size_t capacity = polys[i].capacity() * sizeof(FF);
+        sections.push_back({ polys[i].data().get(), polys[i].size() * sizeof(FF), capacity });
+        offset += MappedSectionsHeader::get_section_span(capacity);
+    }
+
+    write_mapped_sections(
+        path, "proving key", MMAP_PROVING_KEY_MAGIC, MMAP_PROVING_KEY_VERSION, FF::modulus.data[0], metadata, sections);
+}
+
+template <typename Flavor> std::shared_ptr<typename Flavor::ProvingKey> read_mmap_proving_key(std::string const& path)
+{
+    using serialize::read;
+    using FF = typename Flavor::FF;
+    using Polynomial = typename Flavor::Polynomial;
+
+    // Every polynomial read from the key holds a reference to the mapping
+    const auto file = std::make_shared<MappedFile>(path, MappedFile::Access::COPY_ON_WRITE, "proving key");
+    const auto& header =
+        read_mapped_sections_header(*file, MMAP_PROVING_KEY_MAGIC, MMAP_PROVING_KEY_VERSION, FF::modulus.data[0]);
+
+    auto key = std::make_shared<typename Flavor::ProvingKey>();
+    uint8_t const* const metadata = file->data() + sizeof(MappedSectionsHeader);
+    uint8_t const* it = metadata;
+    uint32_t circuit_type = 0;
+    uint64_t circuit_size = 0;
+    uint64_t num_public_inputs = 0;
+    uint64_t num_ecc_op_gates = 0;
+    read(it, circuit_type);
+    read(it, circuit_size);
+    read(it, num_public_inputs);
+    read(it, key->contains_recursive_proof);
+    read(it, key->recursive_proof_public_input_indices);
+    read(it, num_ecc_op_gates);
+    if (circuit_type != static_cast<uint32_t>(Flavor::CircuitBuilder::CIRCUIT_TYPE)) {
+        throw_or_abort(format("Proving key ", path, " was written for another flavor."));
+    }
+    key->circuit_type = Flavor::CircuitBuilder::CIRCUIT_TYPE;
+    key->circuit_size = circuit_size;
+    key->log_circuit_size = numeric::get_msb(circuit_size);
+    key->num_public_inputs = num_public_inputs;
+    key->evaluation_domain = EvaluationDomain<FF>(circuit_size, circuit_size);
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        key->num_ecc_op_gates = num_ecc_op_gates;
+    }
+
+    uint32_t num_polys = 0;
+    read(it, num_polys);
+    auto polys = key->get_precomputed_polynomials();
+    const auto labels = key->get_precomputed_labels();
+    if (num_polys != polys.size()) {
+        throw_or_abort(format("Proving key ", path, " was written for another flavor."));
+    }
+    for (size_t i = 0; i < num_polys; ++i) {
+        std::string label;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        read(it, label);
+        read(it, offset);
+        read(it, size);
+        if (label != labels[i]) {
+            throw_or_abort(format("Proving key ", path, " was written for another flavor."));
+        }
+        const size_t capacity = (size + Polynomial::MAXIMUM_COEFFICIENT_SHIFT) * sizeof(FF);
+        auto* coefficients = reinterpret_cast<FF*>(get_mapped_section(*file, offset, capacity));
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        polys[i] = Polynomial(std::shared_ptr<FF[]>(file, coefficients), size);
+    }
+    if (it > metadata + header.metadata_size) {
+        throw_or_abort(format("Proving key ", path, " has corrupt metadata."));
+    }
+    return key;
+}
+
+template void write_mmap_proving_key<Ultra>(std::string const&, Ultra::ProvingKey&);
+template void write_mmap_proving_key<GoblinUltra>(std::string const&, GoblinUltra::ProvingKey&);
+template std::shared_ptr<Ultra::ProvingKey> read_mmap_proving_key<Ultra>(std::string const&);
+template std::shared_ptr<GoblinUltra::ProvingKey> read_mmap_proving_key<GoblinUltra>(std::string const&);
+
+} // namespace bb::honk::flavor
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
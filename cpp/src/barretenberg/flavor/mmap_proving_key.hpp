@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace bb::honk::flavor {
+
+/**
+ * @brief A memory mappable Honk proving key file is in the MappedSectionsHeader format, with this magic and version.
+ *
+ * @details The metadata holds, in the usual serialization format: the circuit type, size and number of public inputs,
+ * the recursion data of the key, the number of ecc op gates (zero for flavors without them), then for each precomputed
+ * polynomial its label, its offset into the data section and its size. Each polynomial is a section holding its
+ * coefficients in native Montgomery form, padded with zeroes up to its capacity().
+ */
+constexpr uint64_t MMAP_PROVING_KEY_MAGIC = 0x59454b4b4e4f4842; // "BHONKKEY"
+constexpr uint64_t MMAP_PROVING_KEY_VERSION = 1;
+
+/**
+ * @brief Writes the precomputed polynomials of a Honk proving key in the memory mappable format.
+ *
+ * @details Only the data that depends on the circuit description alone is written: selectors, sigmas, ids, tables and
+ * lagrange polynomials. The key is written to a temporary file which is then renamed to `path`, so processes that have
+ * an older key at the same path mapped are unaffected.
+ */
+template <typename Flavor> void write_mmap_proving_key(std::string const& path, typename Flavor::ProvingKey& key);
+
+/**
+ * @brief Reads a Honk proving key written by `write_mmap_proving_key` without copying its polynomials.
+ *
+ * @details The file is mapped privately and the precomputed polynomials of the returned key alias the mapped pages,
+ * which are read lazily and shared between all processes proving with the same key. The witness polynomials of the
+ * returned key are left empty: the key is meant to be handed to a ProverInstance_, which shares the precomputed
+ * polynomials and allocates its own witnesses, so that a single loaded key serves any number of proofs.
+ */
+template <typename Flavor> std::shared_ptr<typename Flavor::ProvingKey> read_mmap_proving_key(std::string const& path);
+
+} // namespace bb::honk::flavor
@@ -510,3 +510,34 @@ TEST_F(StandardPlonkComposer, TestCheckCircuitBroken)
     bool result = builder.check_circuit();
     EXPECT_EQ(result, false);
 }
+
+TEST_F(StandardPlonkComposer, VerifyBatch)
+{
+    // Proofs of a circuit with different witnesses, all verified against the key of the first one
+    std::vector<plonk::proof> proofs;
+    plonk::Verifier verifier;
+    for (size_t i = 0; i < 4; ++i) {
+        auto builder = StandardCircuitBuilder();
+        fr a = fr::random_element(&engine);
+        uint32_t a_idx = builder.add_public_variable(a);
+        uint32_t b_idx = builder.add_variable(a.sqr());
+        builder.create_mul_gate({ a_idx, a_idx, b_idx, fr::one(), fr::neg_one(), fr::zero() });
+
+        auto composer = StandardComposer();
+        auto prover = composer.create_prover(builder);
+        if (i == 0) {
+            verifier = composer.create_verifier(builder);
+        }
+        proofs.emplace_back(prover.construct_proof());
+    }
+    EXPECT_EQ(verifier.verify_batch(proofs), true);
+    // The verifier can be reused, and agrees with verify_proof
+    for (const auto& proof : proofs) {
+        EXPECT_EQ(verifier.verify_proof(proof), true);
+    }
+
+    // A proof presented with a wrong public input fails the whole batch
+    fr::serialize_to_buffer(fr::random_element(&engine), &proofs[2].proof_data[0]);
+    EXPECT_EQ(verifier.verify_proof(proofs[2]), false);
+    EXPECT_EQ(verifier.verify_batch(proofs), false);
+}
@@ -0,0 +1,90 @@
+#include "mmap_proving_key.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/mapped_file.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+namespace bb::plonk {
+
+void write_mmap_proving_key(std::string const& path, proving_key& key)
+{
+    using serialize::write;
+
+    // Write only the pre-computed polys from the store
+    PrecomputedPolyList precomputed_poly_list(key.circuit_type);
+    std::vector<bb::polynomial> polys;
+    std::vector<MappedSection> sections;
+    std::vector<uint8_t> metadata;
+    write(metadata, static_cast<uint32_t>(key.circuit_type));
+    write(metadata, static_cast<uint32_t>(key.circuit_size));
+    write(metadata, static_cast<uint32_t>(key.num_public_inputs));
+    write(metadata, key.contains_recursive_proof);
+    write(metadata, key.recursive_proof_public_input_indices);
+    write(metadata, key.memory_read_records);
+    write(metadata, key.memory_write_records);
+    write(metadata, static_cast<uint32_t>(precomputed_poly_list.size()));
+    uint64_t offset = 0;
+    for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+        std::string poly_id = precomputed_poly_list[i];
+        polys.emplace_back(key.polynomial_store.get(poly_id));
+        write(metadata, poly_id);
+        write(metadata, offset);
+        write(metadata, static_cast<uint64_t>(polys.back().size()));
+        // A polynomial over the mapping must have room for its shifted coefficients, like any other
+        const size_t capacity = polys.back().capacity() * sizeof(bb::fr);
+        sections.push_back({ polys.back().data().get(), polys.back().size() * sizeof(bb::fr), capacity });
+        offset += MappedSectionsHeader::get_section_span(capacity);
+    }
+
+    write_mapped_sections(path,
+                          "proving key",
+                          MMAP_PROVING_KEY_MAGIC,
+                          MMAP_PROVING_KEY_VERSION,
+                          bb::fr::modulus.data[0],
+                          metadata,
+                          sections);
+}
+
+proving_key_data read_mmap_proving_key(std::string const& path)
+{
+    using serialize::read;
+
+    // Every polynomial read from the key holds a reference to the mapping
+    const auto file = std::make_shared<MappedFile>(path, MappedFile::Access::COPY_ON_WRITE, "proving key");
+    const auto& header =
+        read_mapped_sections_header(*file, MMAP_PROVING_KEY_MAGIC, MMAP_PROVING_KEY_VERSION, bb::fr::modulus.data[0]);
+
+    proving_key_data key;
+    uint8_t const* const metadata = file->data() + sizeof(MappedSectionsHeader);
+    uint8_t const* it = metadata;
+    read(it, key.circuit_type);
+    read(it, key.circuit_size);
+    read(it, key.num_public_inputs);
+    read(it, key.contains_recursive_proof);
+    read(it, key.recursive_proof_public_input_indices);
+    read(it, key.memory_read_records);
+    read(it, key.memory_write_records);
+
+    uint32_t num_polys = 0;
+    read(it, num_polys);
+    for (size_t i = 0; i < num_polys; ++i) {
+        std::string label;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        read(it, label);
+        read(it, offset);
+        read(it, size);
+        const size_t capacity = (size + bb::polynomial::MAXIMUM_COEFFICIENT_SHIFT) * sizeof(bb::fr);
+        auto* coefficients = reinterpret_cast<bb::fr*>(get_mapped_section(*file, offset, capacity));
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        key.polynomial_store.put(label, bb::polynomial(std::shared_ptr<bb::fr[]>(file, coefficients), size));
+    }
+    if (it > metadata + header.metadata_size) {
+        throw_or_abort(format("Proving key ", path, " has corrupt metadata."));
+    }
+    return key;
+}
+
+} // namespace bb::plonk
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
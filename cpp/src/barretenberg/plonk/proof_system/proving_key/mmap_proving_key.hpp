@@ -0,0 +1,36 @@
+#pragma once
+#include "proving_key.hpp"
+#include <cstdint>
+#include <string>
+
+namespace bb::plonk {
+
+/**
+ * @brief A memory mappable proving key file is in the MappedSectionsHeader format, with this magic and version.
+ *
+ * @details The metadata holds, in the usual serialization format: the circuit type, size and number of public inputs,
+ * the recursion and memory record data of the key, then for each precomputed polynomial its label, its offset into the
+ * data section and its size. Each polynomial is a section holding its coefficients in native Montgomery form, padded
+ * with zeroes up to its capacity().
+ */
+constexpr uint64_t MMAP_PROVING_KEY_MAGIC = 0x59454b4e4f4c5042; // "BPLONKEY"
+constexpr uint64_t MMAP_PROVING_KEY_VERSION = 1;
+
+/**
+ * @brief Writes the precomputed part of a proving key in the memory mappable format.
+ *
+ * @details The key is written to a temporary file which is then renamed to `path`, so processes that have an older key
+ * at the same path mapped are unaffected.
+ */
+void write_mmap_proving_key(std::string const& path, proving_key& key);
+
+/**
+ * @brief Reads a proving key written by `write_mmap_proving_key` without copying its polynomials.
+ *
+ * @details The file is mapped privately, and the polynomials in the store of the returned data alias the mapped pages.
+ * Pages are only read from disk when first touched, are shared between all processes that map the same file, and are
+ * copied on write if a prover modifies a polynomial. The mapping lives as long as any of the polynomials.
+ */
+proving_key_data read_mmap_proving_key(std::string const& path);
+
+} // namespace bb::plonk
@@ -5,10 +5,12 @@
 #include "barretenberg/plonk/composer/ultra_composer.hpp"
 #include "barretenberg/proof_system/circuit_builder/standard_circuit_builder.hpp"
 #include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
+#include "mmap_proving_key.hpp"
 #include "serialize.hpp"
 
 #ifndef __wasm__
 #include <filesystem>
+#include <fstream>
 #endif
 
 using namespace bb;
@@ -88,6 +90,94 @@ TEST(proving_key, proving_key_from_serialized_key_ultra)
     EXPECT_EQ(p_key.contains_recursive_proof, proving_key->contains_recursive_proof);
 }
 
+#ifndef __wasm__
+namespace {
+// The polynomial held by the store itself, rather than the copy that get() returns
+bb::polynomial get_stored_polynomial(PolynomialStore<bb::fr> const& store, std::string const& poly_id)
+{
+    for (const auto& [label, poly] : store) {
+        if (label == poly_id) {
+            return poly.share();
+        }
+    }
+    return {};
+}
+
+#ifdef __linux__
+// Whether `ptr` lies in a mapping of the file at `path`
+bool is_in_file_mapping(const void* ptr, std::string const& path)
+{
+    const auto address = reinterpret_cast<uintptr_t>(ptr);
+    const std::string suffix = " " + std::filesystem::canonical(path).string();
+    std::ifstream maps("/proc/self/maps");
+    std::string line;
+    while (std::getline(maps, line)) {
+        // start-end perms offset dev inode pathname
+        if (!line.ends_with(suffix)) {
+            continue;
+        }
+        size_t start_length = 0;
+        const uintptr_t start = std::stoull(line, &start_length, 16);
+        const uintptr_t end = std::stoull(line.substr(start_length + 1), nullptr, 16);
+        if (address >= start && address < end) {
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+} // namespace
+
+// Test that a proving key can be written in the memory mappable format and mapped back without copies
+TEST(proving_key, proving_key_from_memory_mapped_key)
+{
+    auto builder = UltraCircuitBuilder();
+    auto composer = UltraComposer();
+    fr a = fr::one();
+    builder.add_public_variable(a);
+
+    plonk::proving_key& p_key = *composer.compute_proving_key(builder);
+    const std::string pk_path = (std::filesystem::temp_directory_path() / "proving_key_from_memory_mapped_key").string();
+    write_mmap_proving_key(pk_path, p_key);
+
+    auto pk_data = read_mmap_proving_key(pk_path);
+    auto crs = std::make_unique<bb::srs::factories::FileCrsFactory<curve::BN254>>("../srs_db/ignition");
+    auto proving_key =
+        std::make_shared<plonk::proving_key>(std::move(pk_data), crs->get_prover_crs(p_key.circuit_size + 1));
+
+    plonk::PrecomputedPolyList precomputed_poly_list(p_key.circuit_type);
+    for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+        std::string poly_id = precomputed_poly_list[i];
+        auto input_poly = p_key.polynomial_store.get(poly_id);
+        auto output_poly = get_stored_polynomial(proving_key->polynomial_store, poly_id);
+        EXPECT_EQ(input_poly, output_poly);
+        // the shifted coefficient past the end must be readable and zero
+        EXPECT_EQ(output_poly[output_poly.size()], fr::zero());
+#ifdef __linux__
+        // the key took over the polynomials aliasing the mapping, rather than copies of them
+        EXPECT_TRUE(is_in_file_mapping(output_poly.data().get(), pk_path));
+#endif
+    }
+
+    EXPECT_EQ(p_key.circuit_type, proving_key->circuit_type);
+    EXPECT_EQ(p_key.circuit_size, proving_key->circuit_size);
+    EXPECT_EQ(p_key.num_public_inputs, proving_key->num_public_inputs);
+    EXPECT_EQ(p_key.contains_recursive_proof, proving_key->contains_recursive_proof);
+    EXPECT_EQ(p_key.memory_read_records, proving_key->memory_read_records);
+    EXPECT_EQ(p_key.memory_write_records, proving_key->memory_write_records);
+
+    // Writes to a mapped polynomial are seen by the key but are private to its mapping
+    const std::string poly_id = precomputed_poly_list[0];
+    auto mapped_poly = get_stored_polynomial(proving_key->polynomial_store, poly_id);
+    mapped_poly[0] += fr::one();
+    EXPECT_EQ(proving_key->polynomial_store.get(poly_id)[0], p_key.polynomial_store.get(poly_id)[0] + fr::one());
+    auto remapped_data = read_mmap_proving_key(pk_path);
+    EXPECT_EQ(remapped_data.polynomial_store.get(poly_id), p_key.polynomial_store.get(poly_id));
+
+    std::filesystem::remove(pk_path);
+}
+#endif
+
 /**
 // Test that a proving key can be serialized/deserialized using mmap
 #ifndef __wasm__
@@ -37,6 +37,54 @@ VerifierBase<program_settings>& VerifierBase<program_settings>::operator=(Verifi
 }
 
 template <typename program_settings> bool VerifierBase<program_settings>::verify_proof(const plonk::proof& proof)
+{
+    auto pairing_inputs = compute_pairing_inputs(proof);
+    return pairing_check(
+        pairing_inputs.scalars, pairing_inputs.elements, pairing_inputs.P_0_offset, pairing_inputs.P_1);
+}
+
+template <typename program_settings>
+bool VerifierBase<program_settings>::verify_batch(const std::vector<plonk::proof>& proofs)
+{
+    if (proofs.empty()) {
+        return true;
+    }
+
+    std::vector<fr> scalars;
+    std::vector<g1::affine_element> elements;
+    // Position in the MSM of the first element seen under each label. Elements the proofs share, the verification key
+    // commitments and [1]_1, are found there and have their scalars summed.
+    std::map<std::string, size_t> first_positions;
+    g1::element P_0_offset = g1::element::infinity();
+    g1::element P_1 = g1::element::infinity();
+
+    for (size_t j = 0; j < proofs.size(); ++j) {
+        auto pairing_inputs = compute_pairing_inputs(proofs[j]);
+
+        // A random combination of the pairing checks holds if and only if each of them does, except with negligible
+        // probability. The weights are only drawn once the proofs are fixed, and the first one can be one.
+        const fr weight = j == 0 ? fr::one() : fr::random_element();
+        for (size_t i = 0; i < pairing_inputs.elements.size(); ++i) {
+            const auto [position, inserted] = first_positions.insert({ pairing_inputs.labels[i], elements.size() });
+            if (!inserted && elements[position->second] == pairing_inputs.elements[i]) {
+                scalars[position->second] += pairing_inputs.scalars[i] * weight;
+                continue;
+            }
+            scalars.emplace_back(pairing_inputs.scalars[i] * weight);
+            elements.emplace_back(pairing_inputs.elements[i]);
+        }
+        if (!pairing_inputs.P_0_offset.is_point_at_infinity()) {
+            P_0_offset += pairing_inputs.P_0_offset * weight;
+        }
+        P_1 += pairing_inputs.P_1 * weight;
+    }
+
+    return pairing_check(scalars, elements, P_0_offset, P_1);
+}
+
+template <typename program_settings>
+typename VerifierBase<program_settings>::PairingInputs VerifierBase<program_settings>::compute_pairing_inputs(
+    const plonk::proof& proof)
 {
     // This function verifies a PLONK proof for given program settings.
     // A PLONK proof for standard PLONK is of the form:
@@ -49,6 +97,10 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
 
     key->program_width = program_settings::program_width;
 
+    // The maps are filled by insertion, drop the entries of any proof verified before
+    kate_g1_elements.clear();
+    kate_fr_elements.clear();
+
     // Add the proof data to the transcript, according to the manifest. Also initialize the transcript's hash type and
     // challenge bytes.
     transcript::StandardTranscript transcript = transcript::StandardTranscript(
@@ -163,26 +215,18 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     kate_g1_elements.insert({ "PI_Z", PI_Z });
     kate_fr_elements.insert({ "PI_Z", zeta });
 
-    std::vector<fr> scalars;
-    std::vector<g1::affine_element> elements;
-
-    for (const auto& [key, value] : kate_g1_elements) {
+    PairingInputs pairing_inputs;
+    for (const auto& [label, value] : kate_g1_elements) {
         // TODO: perhaps we should throw if not on curve or if infinity?
         if (value.on_curve() && !value.is_point_at_infinity()) {
-            scalars.emplace_back(kate_fr_elements.at(key));
-            elements.emplace_back(value);
+            pairing_inputs.labels.emplace_back(label);
+            pairing_inputs.scalars.emplace_back(kate_fr_elements.at(label));
+            pairing_inputs.elements.emplace_back(value);
         }
     }
 
-    size_t num_elements = elements.size();
-    elements.resize(num_elements * 2);
-    bb::scalar_multiplication::generate_pippenger_point_table<curve::BN254>(&elements[0], &elements[0], num_elements);
-    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_elements);
-
-    g1::element P[2];
-
-    P[0] = bb::scalar_multiplication::pippenger<curve::BN254>(&scalars[0], &elements[0], num_elements, state);
-    P[1] = -(g1::element(PI_Z_OMEGA) * separator_challenge + PI_Z);
+    pairing_inputs.P_0_offset = g1::element::infinity();
+    pairing_inputs.P_1 = -(g1::element(PI_Z_OMEGA) * separator_challenge + PI_Z);
 
     if (key->contains_recursive_proof) {
         ASSERT(key->recursive_proof_public_input_indices.size() == 16);
@@ -219,10 +263,30 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
                                                       key->recursive_proof_public_input_indices[14],
                                                       key->recursive_proof_public_input_indices[15]);
 
-        P[0] += g1::element(x0, y0, 1) * recursion_separator_challenge;
-        P[1] += g1::element(x1, y1, 1) * recursion_separator_challenge;
+        pairing_inputs.P_0_offset = g1::element(x0, y0, 1) * recursion_separator_challenge;
+        pairing_inputs.P_1 += g1::element(x1, y1, 1) * recursion_separator_challenge;
     }
 
+    return pairing_inputs;
+}
+
+template <typename program_settings>
+bool VerifierBase<program_settings>::pairing_check(std::vector<fr>& scalars,
+                                                   std::vector<g1::affine_element>& elements,
+                                                   const g1::element& P_0_offset,
+                                                   const g1::element& P_1) const
+{
+    size_t num_elements = elements.size();
+    elements.resize(num_elements * 2);
+    bb::scalar_multiplication::generate_pippenger_point_table<curve::BN254>(&elements[0], &elements[0], num_elements);
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_elements);
+
+    g1::element P[2];
+
+    P[0] = bb::scalar_multiplication::pippenger<curve::BN254>(&scalars[0], &elements[0], num_elements, state);
+    P[0] += P_0_offset;
+    P[1] = P_1;
+
     g1::element::batch_normalize(P, 2);
 
     g1::affine_element P_affine[2]{
@@ -20,12 +20,43 @@ template <typename program_settings> class VerifierBase {
     bool validate_scalars();
 
     bool verify_proof(const plonk::proof& proof);
+
+    /**
+     * @brief Verifies proofs of the circuit of this verifier with a single pairing check
+     *
+     * @details The pairing inputs of each proof are weighted by a random scalar and summed, so that all proofs are
+     * checked by one MSM and one two-pairing final check. The commitments of the verification key, which all proofs
+     * share, enter the MSM once. Returns true iff every proof verifies, except with negligible probability.
+     */
+    bool verify_batch(const std::vector<plonk::proof>& proofs);
+
     transcript::Manifest manifest;
 
     std::shared_ptr<verification_key> key;
     std::map<std::string, bb::g1::affine_element> kate_g1_elements;
     std::map<std::string, bb::fr> kate_fr_elements;
     std::unique_ptr<CommitmentScheme> commitment_scheme;
+
+  private:
+    /**
+     * @brief The inputs of the final pairing check e(P_0, [1]_2).e(P_1, [x]_2) == 1 of a proof
+     *
+     * @details P_0 = sum scalars[i] * elements[i] + P_0_offset, the MSM being left to the caller so that the MSMs of
+     * several proofs can be merged.
+     */
+    struct PairingInputs {
+        std::vector<std::string> labels;
+        std::vector<bb::fr> scalars;
+        std::vector<bb::g1::affine_element> elements;
+        bb::g1::element P_0_offset;
+        bb::g1::element P_1;
+    };
+
+    PairingInputs compute_pairing_inputs(const plonk::proof& proof);
+    bool pairing_check(std::vector<bb::fr>& scalars,
+                       std::vector<bb::g1::affine_element>& elements,
+                       const bb::g1::element& P_0_offset,
+                       const bb::g1::element& P_1) const;
 };
 
 typedef VerifierBase<standard_verifier_settings> Verifier;
@@ -1,7 +1,9 @@
 #include "work_queue.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include <deque>
 
 namespace bb::plonk {
 
@@ -198,89 +200,248 @@ void work_queue::add_to_queue(const work_item& item)
     // #endif
 }
 
-void work_queue::process_queue()
+namespace {
+
+// The polynomial an item reads from the store and the one it writes to it, empty if there is none
+std::string get_input_tag(const work_queue::work_item& item)
 {
-    for (const auto& item : work_item_queue) {
-        switch (item.work_type) {
-        // most expensive op
-        case WorkType::SCALAR_MULTIPLICATION: {
-            // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
-            auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
+    switch (item.work_type) {
+    case work_queue::WorkType::FFT:
+        return item.tag;
+    case work_queue::WorkType::IFFT:
+        return item.tag + "_lagrange";
+    default:
+        return "";
+    }
+}
+
+std::string get_output_tag(const work_queue::work_item& item)
+{
+    switch (item.work_type) {
+    case work_queue::WorkType::FFT:
+        return item.tag + "_fft";
+    case work_queue::WorkType::IFFT:
+        return item.tag;
+    default:
+        return "";
+    }
+}
+
+// Whether the two items have to run in queue order, i.e. one of them writes a polynomial the other reads or writes
+bool items_conflict(const work_queue::work_item& item, const work_queue::work_item& other)
+{
+    const std::string input_tag = get_input_tag(item);
+    const std::string output_tag = get_output_tag(item);
+    const std::string other_input_tag = get_input_tag(other);
+    const std::string other_output_tag = get_output_tag(other);
+    return (!input_tag.empty() && input_tag == other_output_tag) ||
+           (!output_tag.empty() && (output_tag == other_input_tag || output_tag == other_output_tag));
+}
+
+} // namespace
+
+void work_queue::process_fft_batch(const std::vector<const work_item*>& items, std::mutex& mutex)
+{
+    using namespace bb;
+    std::vector<polynomial> wire_ffts;
+    std::vector<fr*> wire_fft_ptrs;
+    wire_ffts.reserve(items.size());
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto* item : items) {
+            auto wire = key->polynomial_store.get(item->tag);
+            wire_ffts.emplace_back(wire, 4 * key->circuit_size + 4);
+            wire_fft_ptrs.emplace_back(&wire_ffts.back()[0]);
+        }
+    }
+
+    polynomial_arithmetic::coset_fft_batch(wire_fft_ptrs, key->large_domain);
+
+    for (size_t j = 0; j < items.size(); ++j) {
+        for (size_t i = 0; i < 4; i++) {
+            wire_ffts[j][4 * key->circuit_size + i] = wire_ffts[j][i];
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t j = 0; j < items.size(); ++j) {
+        key->polynomial_store.put(items[j]->tag + "_fft", std::move(wire_ffts[j]));
+    }
+}
+
+void work_queue::process_item(const work_item& item, std::mutex& mutex)
+{
+    switch (item.work_type) {
+    // most expensive op
+    case WorkType::SCALAR_MULTIPLICATION: {
+        // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
+        auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
+
+        ASSERT(msm_size <= key->reference_string->get_monomial_size());
+
+        bb::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
+
+        // Run pippenger multi-scalar multiplication.
+        auto runtime_state = bb::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
+        bb::g1::affine_element result(bb::scalar_multiplication::pippenger_unsafe<curve::BN254>(
+            item.mul_scalars.get(), srs_points, msm_size, runtime_state));
+
+        std::lock_guard<std::mutex> lock(mutex);
+        transcript->add_element(item.tag, result.to_buffer());
 
-            ASSERT(msm_size <= key->reference_string->get_monomial_size());
+        break;
+    }
+    // Commenting this out as per above.
+    // About 20% of the cost of a scalar multiplication. For WASM, might be a bit more expensive
+    // due to the need to copy memory between web workers
+    // case WorkType::SMALL_FFT: {
+    //     using namespace bb;
+    //     const size_t n = key->circuit_size;
+    //     auto wire = key->polynomial_store.get(item.tag);
+
+    //     polynomial wire_copy(wire, n);
+    //     wire_copy.coset_fft_with_generator_shift(key->small_domain, item.constant);
 
-            bb::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
+    //     if (item.index != 0) {
+    //         auto old_wire_fft = key->polynomial_store.get(item.tag + "_fft");
+    //         for (size_t i = 0; i < n; ++i) {
+    //             old_wire_fft[4 * i + item.index] = wire_copy[i];
+    //         }
+    //         old_wire_fft[4 * n + item.index] = wire_copy[0];
+    //         key->polynomial_store.put(item.tag + "_fft", std::move(old_wire_fft));
+    //     } else {
+    //         polynomial wire_fft(4 * n + 4);
+    //         for (size_t i = 0; i < n; ++i) {
+    //             wire_fft[4 * i + item.index] = wire_copy[i];
+    //         }
+    //         key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
+    //     }
+    //     break;
+    // }
+    case WorkType::FFT: {
+        process_fft_batch({ &item }, mutex);
+        break;
+    }
+    // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
+    case WorkType::IFFT: {
+        using namespace bb;
+        // retrieve wire in lagrange form
+        polynomial wire_lagrange;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            wire_lagrange = key->polynomial_store.get(item.tag + "_lagrange");
+        }
 
-            // Run pippenger multi-scalar multiplication.
-            auto runtime_state = bb::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
-            bb::g1::affine_element result(bb::scalar_multiplication::pippenger_unsafe<curve::BN254>(
-                item.mul_scalars.get(), srs_points, msm_size, runtime_state));
+        // Compute wire monomial form via ifft on lagrange form then add it to the store
+        polynomial wire_monomial(key->circuit_size);
+        polynomial_arithmetic::ifft((fr*)&wire_lagrange[0], &wire_monomial[0], key->small_domain);
 
-            transcript->add_element(item.tag, result.to_buffer());
+        std::lock_guard<std::mutex> lock(mutex);
+        key->polynomial_store.put(item.tag, std::move(wire_monomial));
 
-            break;
+        break;
+    }
+    default: {
+    }
+    }
+}
+
+/**
+ * @brief Run every queued work item
+ *
+ * @details The queue is split into jobs: a single item, or a run of consecutive FFT items that are transformed together
+ * with one batched FFT. Up to `max_concurrent_items` jobs run at once as tasks on the thread pool, so e.g. the MSMs of a
+ * round overlap with its FFTs. A job waits for every earlier job that touches one of its polynomials, unless both only
+ * read it, which keeps the results identical to running the queue in order. Items only share the polynomial store and
+ * the transcript, and all accesses to them are made under one lock.
+ */
+void work_queue::process_queue()
+{
+    std::vector<std::vector<size_t>> jobs;
+    for (size_t i = 0; i < work_item_queue.size(); ++i) {
+        const bool continues_fft_run = work_item_queue[i].work_type == WorkType::FFT && i > 0 &&
+                                       work_item_queue[i - 1].work_type == WorkType::FFT;
+        if (continues_fft_run) {
+            jobs.back().emplace_back(i);
+        } else {
+            jobs.push_back({ i });
         }
-        // Commenting this out as per above.
-        // About 20% of the cost of a scalar multiplication. For WASM, might be a bit more expensive
-        // due to the need to copy memory between web workers
-        // case WorkType::SMALL_FFT: {
-        //     using namespace bb;
-        //     const size_t n = key->circuit_size;
-        //     auto wire = key->polynomial_store.get(item.tag);
-
-        //     polynomial wire_copy(wire, n);
-        //     wire_copy.coset_fft_with_generator_shift(key->small_domain, item.constant);
-
-        //     if (item.index != 0) {
-        //         auto old_wire_fft = key->polynomial_store.get(item.tag + "_fft");
-        //         for (size_t i = 0; i < n; ++i) {
-        //             old_wire_fft[4 * i + item.index] = wire_copy[i];
-        //         }
-        //         old_wire_fft[4 * n + item.index] = wire_copy[0];
-        //         key->polynomial_store.put(item.tag + "_fft", std::move(old_wire_fft));
-        //     } else {
-        //         polynomial wire_fft(4 * n + 4);
-        //         for (size_t i = 0; i < n; ++i) {
-        //             wire_fft[4 * i + item.index] = wire_copy[i];
-        //         }
-        //         key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
-        //     }
-        //     break;
-        // }
-        case WorkType::FFT: {
-            using namespace bb;
-            auto wire = key->polynomial_store.get(item.tag);
-            polynomial wire_fft(wire, 4 * key->circuit_size + 4);
-
-            wire_fft.coset_fft(key->large_domain);
-            for (size_t i = 0; i < 4; i++) {
-                wire_fft[4 * key->circuit_size + i] = wire_fft[i];
+    }
+
+    std::mutex mutex;
+    processed_item_timings = std::vector<work_item_timing>(work_item_queue.size());
+    auto run_job = [&](const std::vector<size_t>& job) {
+        const auto start = std::chrono::steady_clock::now();
+        if (job.size() == 1) {
+            process_item(work_item_queue[job[0]], mutex);
+        } else {
+            std::vector<const work_item*> fft_items;
+            for (const size_t i : job) {
+                fft_items.emplace_back(&work_item_queue[i]);
             }
+            process_fft_batch(fft_items, mutex);
+        }
+        const auto duration =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        for (const size_t i : job) {
+            processed_item_timings[i] = { work_item_queue[i].work_type, work_item_queue[i].tag, duration };
+        }
+    };
 
-            key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
+    if (max_concurrent_items <= 1) {
+        for (const auto& job : jobs) {
+            run_job(job);
+        }
+        work_item_queue = std::vector<work_item>();
+        return;
+    }
 
-            break;
+    std::vector<std::future<void>> job_futures(jobs.size());
+    std::vector<bool> job_done(jobs.size(), false);
+    auto wait_for_job = [&](size_t job_index) {
+        if (!job_done[job_index]) {
+            wait_for_task(job_futures[job_index]);
+            job_done[job_index] = true;
         }
-        // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
-        case WorkType::IFFT: {
-            using namespace bb;
-            // retrieve wire in lagrange form
-            auto wire_lagrange = key->polynomial_store.get(item.tag + "_lagrange");
-
-            // Compute wire monomial form via ifft on lagrange form then add it to the store
-            polynomial wire_monomial(key->circuit_size);
-            polynomial_arithmetic::ifft((fr*)&wire_lagrange[0], &wire_monomial[0], key->small_domain);
-            key->polynomial_store.put(item.tag, std::move(wire_monomial));
-
-            break;
+    };
+
+    std::deque<size_t> running_jobs;
+    for (size_t j = 0; j < jobs.size(); ++j) {
+        for (size_t k = 0; k < j; ++k) {
+            bool depends_on_job = false;
+            for (const size_t i : jobs[j]) {
+                for (const size_t l : jobs[k]) {
+                    depends_on_job |= items_conflict(work_item_queue[i], work_item_queue[l]);
+                }
+            }
+            if (depends_on_job) {
+                wait_for_job(k);
+            }
         }
-        default: {
+
+        while (!running_jobs.empty() && job_done[running_jobs.front()]) {
+            running_jobs.pop_front();
         }
+        if (running_jobs.size() >= max_concurrent_items) {
+            wait_for_job(running_jobs.front());
+            running_jobs.pop_front();
         }
+
+        job_futures[j] = spawn_task([&, j]() { run_job(jobs[j]); });
+        running_jobs.emplace_back(j);
     }
+    for (size_t j = 0; j < jobs.size(); ++j) {
+        wait_for_job(j);
+    }
+
     work_item_queue = std::vector<work_item>();
 }
 
+std::vector<work_queue::work_item_timing> work_queue::get_processed_work_item_timings() const
+{
+    return processed_item_timings;
+}
+
 std::vector<work_queue::work_item> work_queue::get_queue() const
 {
     return work_item_queue;
@@ -2,6 +2,8 @@
 
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/plonk/transcript/transcript_wrappers.hpp"
+#include <chrono>
+#include <mutex>
 
 namespace bb::plonk {
 
@@ -27,6 +29,17 @@ class work_queue {
         const size_t index;
     };
 
+    // How long an item took in the last process_queue. Items transformed together in one batched FFT all get the
+    // duration of the batch.
+    struct work_item_timing {
+        WorkType work_type;
+        std::string tag;
+        std::chrono::nanoseconds duration;
+    };
+
+    // Number of independent work items process_queue runs at once by default
+    static constexpr size_t DEFAULT_MAX_CONCURRENT_ITEMS = 4;
+
     struct queued_fft_inputs {
         std::shared_ptr<fr[]> data;
         bb::fr shift_factor;
@@ -63,9 +76,20 @@ class work_queue {
 
     std::vector<work_item> get_queue() const;
 
+    std::vector<work_item_timing> get_processed_work_item_timings() const;
+
+    // 1 runs the queue in order on the calling thread
+    void set_max_concurrent_items(const size_t num_items) { max_concurrent_items = num_items; }
+
   private:
+    void process_item(const work_item& item, std::mutex& mutex);
+
+    void process_fft_batch(const std::vector<const work_item*>& items, std::mutex& mutex);
+
     proving_key* key;
     transcript::StandardTranscript* transcript;
     std::vector<work_item> work_item_queue;
+    std::vector<work_item_timing> processed_item_timings;
+    size_t max_concurrent_items = DEFAULT_MAX_CONCURRENT_ITEMS;
 };
 } // namespace bb::plonk
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "work_queue.hpp"
+#include "barretenberg/plonk/transcript/transcript.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include "barretenberg/srs/factories/file_crs_factory.hpp"
+#include <gtest/gtest.h>
+
+using namespace bb;
+using namespace bb::plonk;
+
+namespace {
+
+polynomial random_polynomial(const size_t size)
+{
+    polynomial poly(size);
+    for (size_t i = 0; i < size; ++i) {
+        poly[i] = fr::random_element();
+    }
+    return poly;
+}
+
+// Queues the work of a prover round on `key`: IFFTs of some wires, FFTs of wires (one of which was produced by an IFFT
+// in the same queue), and commitments
+void fill_queue(work_queue& queue, const std::shared_ptr<proving_key>& key, const std::vector<polynomial>& commitments)
+{
+    for (size_t i = 0; i < commitments.size(); ++i) {
+        queue.add_to_queue({
+            .work_type = work_queue::WorkType::SCALAR_MULTIPLICATION,
+            .mul_scalars = commitments[i].data(),
+            .tag = "C_" + std::to_string(i),
+            .constant = fr(key->circuit_size),
+            .index = 0,
+        });
+    }
+    for (const std::string tag : { "w_1", "w_2" }) {
+        queue.add_to_queue({
+            .work_type = work_queue::WorkType::IFFT,
+            .mul_scalars = nullptr,
+            .tag = tag,
+            .constant = 0,
+            .index = 0,
+        });
+    }
+    for (const std::string tag : { "w_2", "w_3", "w_4" }) {
+        queue.add_to_queue({
+            .work_type = work_queue::WorkType::FFT,
+            .mul_scalars = nullptr,
+            .tag = tag,
+            .constant = 0,
+            .index = 0,
+        });
+    }
+}
+
+std::shared_ptr<proving_key> make_key(const size_t n, const std::vector<polynomial>& wires)
+{
+    auto crs_factory = std::make_shared<bb::srs::factories::FileCrsFactory<curve::BN254>>("../srs_db/ignition");
+    auto key = std::make_shared<proving_key>(n, 0, crs_factory->get_prover_crs(n), CircuitType::STANDARD);
+    key->polynomial_store.put("w_1_lagrange", polynomial(wires[0]));
+    key->polynomial_store.put("w_2_lagrange", polynomial(wires[1]));
+    key->polynomial_store.put("w_2", polynomial(wires[2]));
+    key->polynomial_store.put("w_3", polynomial(wires[3]));
+    key->polynomial_store.put("w_4", polynomial(wires[4]));
+    return key;
+}
+
+} // namespace
+
+TEST(work_queue, concurrent_processing_matches_in_order_processing)
+{
+    constexpr size_t n = 256;
+    constexpr size_t num_commitments = 3;
+
+    std::vector<polynomial> wires;
+    for (size_t i = 0; i < 5; ++i) {
+        wires.emplace_back(random_polynomial(n));
+    }
+    std::vector<polynomial> commitments;
+    for (size_t i = 0; i < num_commitments; ++i) {
+        commitments.emplace_back(random_polynomial(n));
+    }
+
+    auto in_order_key = make_key(n, wires);
+    transcript::StandardTranscript in_order_transcript{ transcript::Manifest() };
+    work_queue in_order_queue(in_order_key.get(), &in_order_transcript);
+    in_order_queue.set_max_concurrent_items(1);
+    fill_queue(in_order_queue, in_order_key, commitments);
+    in_order_queue.process_queue();
+
+    auto concurrent_key = make_key(n, wires);
+    transcript::StandardTranscript concurrent_transcript{ transcript::Manifest() };
+    work_queue concurrent_queue(concurrent_key.get(), &concurrent_transcript);
+    concurrent_queue.set_max_concurrent_items(4);
+    fill_queue(concurrent_queue, concurrent_key, commitments);
+    concurrent_queue.process_queue();
+
+    for (size_t i = 0; i < num_commitments; ++i) {
+        const std::string tag = "C_" + std::to_string(i);
+        EXPECT_EQ(concurrent_transcript.get_element(tag), in_order_transcript.get_element(tag));
+    }
+    for (const std::string tag : { "w_1", "w_2", "w_2_fft", "w_3_fft", "w_4_fft" }) {
+        EXPECT_EQ(concurrent_key->polynomial_store.get(tag), in_order_key->polynomial_store.get(tag));
+    }
+
+    // The FFT of w_2 has to see the output of the IFFT queued before it
+    polynomial expected_w_2_fft(in_order_key->polynomial_store.get("w_2"), 4 * n + 4);
+    expected_w_2_fft.coset_fft(in_order_key->large_domain);
+    for (size_t i = 0; i < 4 * n; ++i) {
+        EXPECT_EQ(concurrent_key->polynomial_store.get("w_2_fft")[i], expected_w_2_fft[i]);
+    }
+
+    const auto timings = concurrent_queue.get_processed_work_item_timings();
+    EXPECT_EQ(timings.size(), num_commitments + 5);
+    EXPECT_EQ(timings[0].work_type, work_queue::WorkType::SCALAR_MULTIPLICATION);
+    EXPECT_EQ(timings.back().tag, "w_4");
+}
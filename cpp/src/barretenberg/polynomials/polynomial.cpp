@@ -92,6 +92,15 @@ template <typename Fr> Polynomial<Fr>::Polynomial(std::span<const Fr> coefficien
     zero_memory_beyond(size_);
 }
 
+// aliasing constructor, does not copy
+template <typename Fr>
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+Polynomial<Fr>::Polynomial(std::shared_ptr<Fr[]> backing_memory, const size_t size)
+    : backing_memory_(std::move(backing_memory))
+    , coefficients_(backing_memory_.get())
+    , size_(size)
+{}
+
 // interpolation constructor
 template <typename Fr>
 Polynomial<Fr>::Polynomial(std::span<const Fr> interpolation_points, std::span<const Fr> evaluations)
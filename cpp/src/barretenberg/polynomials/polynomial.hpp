@@ -24,6 +24,10 @@ template <typename Fr> class Polynomial {
     using const_iterator = Fr const*;
     using FF = Fr;
 
+    // When a polynomial is instantiated from a size alone, the memory allocated corresponds to
+    // input size + MAXIMUM_COEFFICIENT_SHIFT to support 'shifted' coefficients efficiently.
+    const static size_t MAXIMUM_COEFFICIENT_SHIFT = 1;
+
     Polynomial(size_t initial_size);
     // Constructor that does not initialize values, use with caution to save time.
     Polynomial(size_t initial_size, DontZeroMemory flag);
@@ -35,6 +39,11 @@ template <typename Fr> class Polynomial {
     // Create a polynomial from the given fields.
     Polynomial(std::span<const Fr> coefficients);
 
+    // Create a polynomial over memory owned elsewhere (e.g. a memory mapped file) without copying it. The memory must
+    // hold at least `size + MAXIMUM_COEFFICIENT_SHIFT` elements, i.e. the capacity() of the polynomial.
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    Polynomial(std::shared_ptr<Fr[]> backing_memory, size_t size);
+
     // Allow polynomials to be entirely reset/dormant
     Polynomial() = default;
 
@@ -240,10 +249,6 @@ template <typename Fr> class Polynomial {
     bool in_place_operation_viable(size_t domain_size = 0) { return (size() >= domain_size); }
 
     void zero_memory_beyond(size_t start_position);
-    // When a polynomial is instantiated from a size alone, the memory allocated corresponds to
-    // input size + MAXIMUM_COEFFICIENT_SHIFT to support 'shifted' coefficients efficiently.
-    const static size_t MAXIMUM_COEFFICIENT_SHIFT = 1;
-
     // The memory
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
     std::shared_ptr<Fr[]> backing_memory_;
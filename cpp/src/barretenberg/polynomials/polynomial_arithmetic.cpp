@@ -391,6 +391,284 @@ void fft_inner_parallel(
     }
 }
 
+namespace {
+
+// Side of the square tiles the transposes of the four-step FFT are done in, small enough that a tile of the source and
+// one of the destination sit in L1 together
+constexpr size_t TRANSPOSE_TILE_SIZE = 16;
+
+/**
+ * @brief Split `num_items` into contiguous ranges, one per thread, and call `func(start, end)` on each of them in
+ * parallel. Both `num_items` and `num_threads` are powers of two.
+ */
+inline void parallel_for_ranges(const size_t num_items,
+                                const size_t num_threads,
+                                const std::function<void(size_t, size_t)>& func)
+{
+    const size_t num_chunks = std::min(num_items, num_threads);
+    const size_t chunk_size = num_items / num_chunks;
+    parallel_for(num_chunks, [&](size_t j) { func(j * chunk_size, (j + 1) * chunk_size); });
+}
+
+/**
+ * @brief Write the transpose of the row-major `num_rows` x `num_cols` matrix `src` into `dest`, a tile at a time
+ */
+template <typename Fr>
+void transpose_blocked(
+    const Fr* src, Fr* dest, const size_t num_rows, const size_t num_cols, const size_t num_threads)
+{
+    const size_t num_row_tiles = (num_rows + TRANSPOSE_TILE_SIZE - 1) / TRANSPOSE_TILE_SIZE;
+    parallel_for_ranges(num_row_tiles, num_threads, [&](size_t start, size_t end) {
+        for (size_t row_start = start * TRANSPOSE_TILE_SIZE; row_start < end * TRANSPOSE_TILE_SIZE;
+             row_start += TRANSPOSE_TILE_SIZE) {
+            const size_t row_end = std::min(row_start + TRANSPOSE_TILE_SIZE, num_rows);
+            for (size_t col_start = 0; col_start < num_cols; col_start += TRANSPOSE_TILE_SIZE) {
+                const size_t col_end = std::min(col_start + TRANSPOSE_TILE_SIZE, num_cols);
+                for (size_t row = row_start; row < row_end; ++row) {
+                    for (size_t col = col_start; col < col_end; ++col) {
+                        Fr::__copy(src[row * num_cols + col], dest[col * num_rows + row]);
+                    }
+                }
+            }
+        }
+    });
+}
+
+/**
+ * @brief Lay out the twiddle factors of the radix-4 rounds of FFTs of size up to 2^max_log2_size contiguously
+ *
+ * @details The round that combines blocks of size m into blocks of size 4m needs t_j = ω_{4m}^j, t_j^2 and t_j^3 for
+ * j < m. They are stored as consecutive triples starting at offset 3(m - 1), so a round reads its twiddles in order.
+ * All of them come from the round roots, which hold ω_{4m}^j for j < 2m, using ω_{4m}^{2m} = -1 for the cubes that are
+ * out of range.
+ */
+template <typename Fr>
+std::vector<Fr> compute_radix_4_twiddles(const size_t max_log2_size, const std::vector<Fr*>& root_table)
+{
+    const size_t max_quarter_size = 1UL << (max_log2_size - 2);
+    std::vector<Fr> twiddles(3 * (2 * max_quarter_size - 1));
+    for (size_t m = 1; m <= max_quarter_size; m <<= 1) {
+        const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m))];
+        Fr* round_twiddles = &twiddles[3 * (m - 1)];
+        for (size_t j = 0; j < m; ++j) {
+            const size_t cube_index = 3 * j;
+            round_twiddles[3 * j] = round_roots[j];
+            round_twiddles[3 * j + 1] = round_roots[2 * j];
+            round_twiddles[3 * j + 2] =
+                cube_index < 2 * m ? round_roots[cube_index] : -round_roots[cube_index - 2 * m];
+        }
+    }
+    return twiddles;
+}
+
+/**
+ * @brief In-place FFT of 2^log2_size contiguous elements, with radix-4 rounds after a radix-2 one if the number of
+ * rounds is odd
+ *
+ * @details A radix-4 round does the work of two radix-2 rounds with the same four multiplications per four elements
+ * (three twiddles and the fourth root of unity), but in a single pass over the data. On input blocks
+ * (a_0, a_1, a_2, a_3) of stride m, which have already been through the previous rounds, it computes
+ *      a_0 + t^2.a_1 ± (t.a_2 + t^3.a_3)   and   a_0 - t^2.a_1 ± ω_4.(t.a_2 - t^3.a_3)
+ */
+template <typename Fr>
+void fft_block_radix_4(Fr* coeffs, const size_t log2_size, const Fr* twiddles, const Fr& fourth_root)
+{
+    const size_t size = 1UL << log2_size;
+    for (size_t i = 0; i < size; ++i) {
+        const size_t swap_index = reverse_bits(static_cast<uint32_t>(i), static_cast<uint32_t>(log2_size));
+        if (i < swap_index) {
+            Fr::__swap(coeffs[i], coeffs[swap_index]);
+        }
+    }
+
+    size_t m = 1;
+    if ((log2_size & 1) == 1) {
+        Fr temp;
+        for (size_t k = 0; k < size; k += 2) {
+            Fr::__copy(coeffs[k + 1], temp);
+            coeffs[k + 1] = coeffs[k] - temp;
+            coeffs[k] += temp;
+        }
+        m = 2;
+    }
+
+    for (; 4 * m <= size; m <<= 2) {
+        const Fr* round_twiddles = &twiddles[3 * (m - 1)];
+        for (size_t k = 0; k < size; k += 4 * m) {
+            for (size_t j = 0; j < m; ++j) {
+                Fr* block = &coeffs[k + j];
+                const Fr t2_a1 = round_twiddles[3 * j + 1] * block[m];
+                const Fr t_a2 = round_twiddles[3 * j] * block[2 * m];
+                const Fr t3_a3 = round_twiddles[3 * j + 2] * block[3 * m];
+                const Fr even_sum = block[0] + t2_a1;
+                const Fr even_diff = block[0] - t2_a1;
+                const Fr odd_sum = t_a2 + t3_a3;
+                const Fr odd_diff = fourth_root * (t_a2 - t3_a3);
+                block[0] = even_sum + odd_sum;
+                block[2 * m] = even_sum - odd_sum;
+                block[m] = even_diff + odd_diff;
+                block[3 * m] = even_diff - odd_diff;
+            }
+        }
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Four-step (Bailey) FFT: split the domain into a n_1 x n_2 matrix and do the butterflies on rows that fit in
+ * cache
+ *
+ * @details With n = n_1.n_2, input index j = j_1.n_2 + j_2 and output index k = k_1 + n_1.k_2,
+ *
+ *      X[k_1 + n_1.k_2] = \sum_{j_2} ω_{n_2}^{j_2.k_2} . ω_n^{j_2.k_1} . \sum_{j_1} x[j_1.n_2 + j_2] . ω_{n_1}^{j_1.k_1}
+ *
+ * so the FFT is n_2 FFTs of size n_1 over the columns, a pointwise product with ω_n^{j_2.k_1} and n_1 FFTs of size n_2
+ * over the rows. The columns are made contiguous with cache-blocked transposes through the scratch space, and a last
+ * transpose puts the output back in natural order. Every small FFT is a radix-4 `fft_block_radix_4`.
+ *
+ * Where the radix-2 `fft_inner_parallel` streams the whole polynomial through memory once per round, this makes a
+ * constant number of passes over it, which is what matters once the domain is well past the size of L2.
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_four_step(Fr* coeffs, const EvaluationDomain<Fr>& domain, const std::vector<Fr*>& root_table)
+{
+    ASSERT(domain.log2_size >= 4);
+    const size_t log2_num_rows = (domain.log2_size + 1) >> 1;
+    const size_t log2_num_cols = domain.log2_size - log2_num_rows;
+    const size_t num_rows = 1UL << log2_num_rows; // n_1
+    const size_t num_cols = 1UL << log2_num_cols; // n_2
+
+    auto scratch_space_ptr = get_scratch_space<Fr>(domain.size);
+    auto scratch_space = scratch_space_ptr.get();
+
+    // n_1 >= n_2, so these cover the FFTs of both sizes
+    const std::vector<Fr> twiddles = compute_radix_4_twiddles(log2_num_rows, root_table);
+    const Fr fourth_root = root_table[0][1];
+    // ω_n^j for j < n / 2
+    const Fr* domain_roots = root_table[domain.log2_size - 2];
+
+    // Step 1: the columns of the input become the rows of the scratch space
+    transpose_blocked(coeffs, scratch_space, num_rows, num_cols, domain.num_threads);
+
+    // Step 2: FFT each of them and multiply the entry (j_2, k_1) by ω_n^{j_2.k_1}
+    parallel_for_ranges(num_cols, domain.num_threads, [&](size_t start, size_t end) {
+        for (size_t row = start; row < end; ++row) {
+            Fr* row_coeffs = scratch_space + (row << log2_num_rows);
+            fft_block_radix_4(row_coeffs, log2_num_rows, twiddles.data(), fourth_root);
+            const Fr& row_root = domain_roots[row];
+            Fr twiddle = row_root;
+            for (size_t i = 1; i < num_rows; ++i) {
+                row_coeffs[i] *= twiddle;
+                twiddle *= row_root;
+            }
+        }
+    });
+
+    // Step 3: back to n_1 x n_2, then FFT each row
+    transpose_blocked(scratch_space, coeffs, num_cols, num_rows, domain.num_threads);
+    parallel_for_ranges(num_rows, domain.num_threads, [&](size_t start, size_t end) {
+        for (size_t row = start; row < end; ++row) {
+            fft_block_radix_4(coeffs + (row << log2_num_cols), log2_num_cols, twiddles.data(), fourth_root);
+        }
+    });
+
+    // Step 4: entry (k_1, k_2) holds X[k_1 + n_1.k_2], so a last transpose gives the natural order
+    transpose_blocked(coeffs, scratch_space, num_rows, num_cols, domain.num_threads);
+    parallel_for_ranges(domain.size, domain.num_threads, [&](size_t start, size_t end) {
+        memcpy(static_cast<void*>(coeffs + start),
+               static_cast<const void*>(scratch_space + start),
+               (end - start) * sizeof(Fr));
+    });
+}
+
+/**
+ * @brief In-place FFT over the whole domain with the engine suited to its size
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& root, const std::vector<Fr*>& root_table)
+{
+    if (domain.log2_size >= FOUR_STEP_FFT_MIN_LOG2_SIZE) {
+        fft_inner_four_step(coeffs, domain, root_table);
+    } else {
+        fft_inner_parallel({ coeffs }, domain, root, root_table);
+    }
+}
+
+/**
+ * @brief In-place FFT of several polynomials over the same domain, one butterfly round at a time across all of them
+ *
+ * @details Each round loads a root from the table once and applies the butterfly at that position to every
+ * polynomial, so the root lookups and index arithmetic are shared by the whole batch and each thread's slice of a
+ * round holds `polys.size()` times more work than for a single polynomial.
+ *
+ * That only pays while the whole batch stays in cache. From FOUR_STEP_FFT_MIN_LOG2_SIZE on, interleaving the
+ * polynomials would multiply the working set of every radix-2 round by the batch size, so each of them goes through the
+ * four-step engine on its own instead.
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_batch(const std::vector<Fr*>& polys,
+                     const EvaluationDomain<Fr>& domain,
+                     const std::vector<Fr*>& root_table)
+{
+    if (polys.empty() || domain.size < 2) {
+        return;
+    }
+    if (domain.log2_size >= FOUR_STEP_FFT_MIN_LOG2_SIZE) {
+        for (Fr* poly : polys) {
+            fft_inner_four_step(poly, domain, root_table);
+        }
+        return;
+    }
+
+    parallel_for(domain.num_threads, [&](size_t j) {
+        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); ++i) {
+            const size_t swap_index = reverse_bits(static_cast<uint32_t>(i), static_cast<uint32_t>(domain.log2_size));
+            if (i < swap_index) {
+                for (Fr* poly : polys) {
+                    Fr::__swap(poly[i], poly[swap_index]);
+                }
+            }
+        }
+    });
+
+    // The first round only needs the square roots of unity, so it has no multiplications
+    parallel_for(domain.num_threads, [&](size_t j) {
+        Fr temp;
+        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
+            for (Fr* poly : polys) {
+                Fr::__copy(poly[i + 1], temp);
+                poly[i + 1] = poly[i] - temp;
+                poly[i] += temp;
+            }
+        }
+    });
+
+    // Same flattened indexing as `fft_inner_parallel`
+    for (size_t m = 2; m < domain.size; m <<= 1) {
+        parallel_for(domain.num_threads, [&](size_t j) {
+            Fr temp;
+            const size_t start = j * (domain.thread_size >> 1);
+            const size_t end = (j + 1) * (domain.thread_size >> 1);
+            const size_t block_mask = m - 1;
+            const size_t index_mask = ~block_mask;
+            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+            for (size_t i = start; i < end; ++i) {
+                const size_t k1 = ((i & index_mask) << 1) + (i & block_mask);
+                const Fr& round_root = round_roots[i & block_mask];
+                for (Fr* poly : polys) {
+                    temp = round_root * poly[k1 + m];
+                    poly[k1 + m] = poly[k1] - temp;
+                    poly[k1] += temp;
+                }
+            }
+        });
+    }
+}
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void partial_fft_serial_inner(Fr* coeffs,
@@ -524,7 +802,7 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void fft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root, domain.get_round_roots());
+    fft_inner(coeffs, domain, domain.root, domain.get_round_roots());
 }
 
 template <typename Fr>
@@ -545,7 +823,7 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    fft_inner(coeffs, domain, domain.root_inverse, domain.get_inverse_round_roots());
     ITERATE_OVER_DOMAIN_START(domain);
     coeffs[i] *= domain.domain_inverse;
     ITERATE_OVER_DOMAIN_END;
@@ -583,7 +861,7 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root, domain.get_round_roots());
+    fft_inner(coeffs, domain, domain.root, domain.get_round_roots());
     ITERATE_OVER_DOMAIN_START(domain);
     coeffs[i] *= value;
     ITERATE_OVER_DOMAIN_END;
@@ -704,7 +982,7 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    fft_inner(coeffs, domain, domain.root_inverse, domain.get_inverse_round_roots());
     Fr T0 = domain.domain_inverse * value;
     ITERATE_OVER_DOMAIN_START(domain);
     coeffs[i] *= T0;
@@ -737,6 +1015,45 @@ void coset_ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
     }
 }
 
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    fft_inner_batch(polys, domain, domain.get_round_roots());
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void ifft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    fft_inner_batch(polys, domain, domain.get_inverse_round_roots());
+    ITERATE_OVER_DOMAIN_START(domain);
+    for (Fr* poly : polys) {
+        poly[i] *= domain.domain_inverse;
+    }
+    ITERATE_OVER_DOMAIN_END;
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    for (Fr* poly : polys) {
+        scale_by_generator(poly, poly, domain, Fr::one(), domain.generator, domain.generator_size);
+    }
+    fft_batch(polys, domain);
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_ifft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    ifft_batch(polys, domain);
+    for (Fr* poly : polys) {
+        scale_by_generator(poly, poly, domain, Fr::one(), domain.generator_inverse, domain.size);
+    }
+}
+
 template <typename Fr>
 void add(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationDomain<Fr>& domain)
 {
@@ -872,7 +1189,7 @@ void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
     });
 
     // Compute 1/(X_i - 1) using Montgomery batch inversion
-    Fr::batch_invert(l_1_coefficients, target_domain.size);
+    Fr::parallel_batch_invert(std::span{ l_1_coefficients, target_domain.size });
 
     // Step 2: Compute numerator (1/n)*(X_i^n - 1)
     // First compute X_i^n (which forms a multiplicative subgroup of order k)
@@ -1146,7 +1463,7 @@ Fr compute_barycentric_evaluation(const Fr* coeffs,
         work_root *= domain.root_inverse;
     }
 
-    Fr::batch_invert(denominators, num_coeffs);
+    Fr::parallel_batch_invert(std::span{ denominators, num_coeffs });
 
     Fr result = Fr::zero();
 
@@ -1371,6 +1688,9 @@ template fr evaluate<fr>(const std::vector<fr*>, const fr&, const size_t);
 template void copy_polynomial<fr>(const fr*, fr*, size_t, size_t);
 template void fft_inner_serial<fr>(std::vector<fr*>, const size_t, const std::vector<fr*>&);
 template void fft_inner_parallel<fr>(std::vector<fr*>, const EvaluationDomain<fr>&, const fr&, const std::vector<fr*>&);
+template void fft_inner_four_step<fr>(fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&);
+template void fft_inner<fr>(fr*, const EvaluationDomain<fr>&, const fr&, const std::vector<fr*>&);
+template void fft_inner_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&, const std::vector<fr*>&);
 template void fft<fr>(fr*, const EvaluationDomain<fr>&);
 template void fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 template void fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
@@ -1387,6 +1707,10 @@ template void ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 template void ifft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 template void coset_ifft<fr>(fr*, const EvaluationDomain<fr>&);
 template void coset_ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+template void fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void ifft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void coset_fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void coset_ifft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
 template void partial_fft_serial_inner<fr>(fr*, fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&);
 template void partial_fft_parellel_inner<fr>(fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&, fr, bool);
 template void partial_fft_serial<fr>(fr*, fr*, const EvaluationDomain<fr>&);
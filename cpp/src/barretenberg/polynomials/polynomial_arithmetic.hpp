@@ -38,6 +38,23 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
                         const Fr&,
                         const std::vector<Fr*>& root_table);
 
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_four_step(Fr* coeffs, const EvaluationDomain<Fr>& domain, const std::vector<Fr*>& root_table);
+
+// Domains of at least this size go through the cache-blocked four-step FFT in `fft`, `ifft` and the coset FFTs built on
+// them; smaller ones fit in cache and keep the radix-2 `fft_inner_parallel`
+constexpr size_t FOUR_STEP_FFT_MIN_LOG2_SIZE = 17;
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& root, const std::vector<Fr*>& root_table);
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_batch(const std::vector<Fr*>& polys,
+                     const EvaluationDomain<Fr>& domain,
+                     const std::vector<Fr*>& root_table);
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft(Fr* coeffs, const EvaluationDomain<Fr>& domain);
@@ -95,6 +112,22 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain);
 
+// Transforms of several polynomials of size `domain.size` at once, each in place. Unlike the `std::vector<Fr*>`
+// overloads above, which treat the vector as the pieces of one polynomial, every pointer here is its own polynomial
+// and the butterfly rounds are interleaved across all of them.
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void ifft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void coset_ifft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void partial_fft_serial_inner(Fr* coeffs,
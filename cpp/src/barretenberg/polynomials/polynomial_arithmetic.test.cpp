@@ -136,6 +136,31 @@ TEST(polynomials, basic_fft)
     aligned_free(data);
 }
 
+TEST(polynomials, four_step_fft_matches_radix_2_fft)
+{
+    // Both an even and an odd number of rounds, so the four-step split is square in one case and not in the other
+    for (size_t log2_n : { 4UL, 5UL, 10UL, 13UL }) {
+        const size_t n = 1UL << log2_n;
+        std::vector<fr> result(n);
+        std::vector<fr> expected(n);
+        for (size_t i = 0; i < n; ++i) {
+            result[i] = fr::random_element();
+            expected[i] = result[i];
+        }
+
+        auto domain = evaluation_domain(n);
+        domain.compute_lookup_table();
+        polynomial_arithmetic::fft_inner_four_step(result.data(), domain, domain.get_round_roots());
+        polynomial_arithmetic::fft_inner_parallel({ expected.data() }, domain, domain.root, domain.get_round_roots());
+        EXPECT_EQ(result, expected);
+
+        polynomial_arithmetic::fft_inner_four_step(result.data(), domain, domain.get_inverse_round_roots());
+        polynomial_arithmetic::fft_inner_parallel(
+            { expected.data() }, domain, domain.root_inverse, domain.get_inverse_round_roots());
+        EXPECT_EQ(result, expected);
+    }
+}
+
 TEST(polynomials, fft_ifft_consistency)
 {
     constexpr size_t n = 256;
@@ -156,6 +181,80 @@ TEST(polynomials, fft_ifft_consistency)
     }
 }
 
+TEST(polynomials, batch_fft_matches_individual_fft)
+{
+    constexpr size_t n = 1 << 10;
+    constexpr size_t num_polys = 5;
+    auto domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+
+    std::vector<std::vector<fr>> batch(num_polys, std::vector<fr>(n));
+    std::vector<std::vector<fr>> expected(num_polys, std::vector<fr>(n));
+    std::vector<fr*> batch_ptrs;
+    for (size_t j = 0; j < num_polys; ++j) {
+        for (size_t i = 0; i < n; ++i) {
+            batch[j][i] = fr::random_element();
+            expected[j][i] = batch[j][i];
+        }
+        batch_ptrs.emplace_back(batch[j].data());
+    }
+
+    polynomial_arithmetic::fft_batch(batch_ptrs, domain);
+    for (auto& poly : expected) {
+        polynomial_arithmetic::fft(poly.data(), domain);
+    }
+    EXPECT_EQ(batch, expected);
+
+    polynomial_arithmetic::coset_ifft_batch(batch_ptrs, domain);
+    for (auto& poly : expected) {
+        polynomial_arithmetic::coset_ifft(poly.data(), domain);
+    }
+    EXPECT_EQ(batch, expected);
+
+    polynomial_arithmetic::coset_fft_batch(batch_ptrs, domain);
+    for (auto& poly : expected) {
+        polynomial_arithmetic::coset_fft(poly.data(), domain);
+    }
+    EXPECT_EQ(batch, expected);
+
+    polynomial_arithmetic::ifft_batch(batch_ptrs, domain);
+    for (auto& poly : expected) {
+        polynomial_arithmetic::ifft(poly.data(), domain);
+    }
+    EXPECT_EQ(batch, expected);
+}
+
+TEST(polynomials, batch_fft_matches_individual_fft_four_step)
+{
+    constexpr size_t n = 1UL << polynomial_arithmetic::FOUR_STEP_FFT_MIN_LOG2_SIZE;
+    constexpr size_t num_polys = 2;
+    auto domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+
+    std::vector<std::vector<fr>> batch(num_polys, std::vector<fr>(n));
+    std::vector<std::vector<fr>> expected(num_polys, std::vector<fr>(n));
+    std::vector<fr*> batch_ptrs;
+    for (size_t j = 0; j < num_polys; ++j) {
+        for (size_t i = 0; i < n; ++i) {
+            batch[j][i] = fr::random_element();
+            expected[j][i] = batch[j][i];
+        }
+        batch_ptrs.emplace_back(batch[j].data());
+    }
+
+    polynomial_arithmetic::coset_fft_batch(batch_ptrs, domain);
+    for (auto& poly : expected) {
+        polynomial_arithmetic::coset_fft(poly.data(), domain);
+    }
+    EXPECT_EQ(batch, expected);
+
+    polynomial_arithmetic::coset_ifft_batch(batch_ptrs, domain);
+    for (auto& poly : expected) {
+        polynomial_arithmetic::coset_ifft(poly.data(), domain);
+    }
+    EXPECT_EQ(batch, expected);
+}
+
 TEST(polynomials, split_polynomial_fft_ifft_consistency)
 {
     constexpr size_t n = 256;
@@ -238,6 +238,81 @@ void fft_bench_parallel(State& state) noexcept
 }
 BENCHMARK(fft_bench_parallel)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
 
+void fft_bench_four_step(State& state) noexcept
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    auto domain = bb::evaluation_domain(n);
+    domain.compute_lookup_table();
+    std::vector<fr> data(n);
+    for (auto& coeff : data) {
+        coeff = fr::random_element();
+    }
+    for (auto _ : state) {
+        bb::polynomial_arithmetic::fft_inner_four_step(data.data(), domain, domain.get_round_roots());
+    }
+}
+BENCHMARK(fft_bench_four_step)->RangeMultiplier(2)->Range(1 << 16, 1 << 24)->Unit(benchmark::kMillisecond);
+
+void fft_bench_radix_2(State& state) noexcept
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    auto domain = bb::evaluation_domain(n);
+    domain.compute_lookup_table();
+    std::vector<fr> data(n);
+    for (auto& coeff : data) {
+        coeff = fr::random_element();
+    }
+    for (auto _ : state) {
+        bb::polynomial_arithmetic::fft_inner_parallel({ data.data() }, domain, domain.root, domain.get_round_roots());
+    }
+}
+BENCHMARK(fft_bench_radix_2)->RangeMultiplier(2)->Range(1 << 16, 1 << 24)->Unit(benchmark::kMillisecond);
+
+// The coset FFTs of the wires onto the 4n domain, as the Plonk work queue does them: batched, or one at a time
+constexpr size_t NUM_BATCHED_WIRES = 4;
+
+void coset_fft_wires_bench(State& state, const bool batched) noexcept
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    auto domain = bb::evaluation_domain(n);
+    domain.compute_lookup_table();
+    std::vector<std::vector<fr>> wires(NUM_BATCHED_WIRES, std::vector<fr>(n));
+    std::vector<fr*> wire_ptrs;
+    for (auto& wire : wires) {
+        for (auto& coeff : wire) {
+            coeff = fr::random_element();
+        }
+        wire_ptrs.emplace_back(wire.data());
+    }
+    for (auto _ : state) {
+        if (batched) {
+            bb::polynomial_arithmetic::coset_fft_batch(wire_ptrs, domain);
+        } else {
+            for (fr* wire : wire_ptrs) {
+                bb::polynomial_arithmetic::coset_fft(wire, domain);
+            }
+        }
+    }
+}
+
+void coset_fft_wires_batched_bench(State& state) noexcept
+{
+    coset_fft_wires_bench(state, true);
+}
+BENCHMARK(coset_fft_wires_batched_bench)
+    ->RangeMultiplier(2)
+    ->Range(START * 4, MAX_GATES * 4)
+    ->Unit(benchmark::kMillisecond);
+
+void coset_fft_wires_individual_bench(State& state) noexcept
+{
+    coset_fft_wires_bench(state, false);
+}
+BENCHMARK(coset_fft_wires_individual_bench)
+    ->RangeMultiplier(2)
+    ->Range(START * 4, MAX_GATES * 4)
+    ->Unit(benchmark::kMillisecond);
+
 void fft_bench_serial(State& state) noexcept
 {
     for (auto _ : state) {
@@ -60,6 +60,17 @@ template <class Fr, size_t domain_end, size_t domain_start = 0> class Univariate
     const Fr& value_at(size_t i) const { return evaluations[i - domain_start]; };
     size_t size() { return evaluations.size(); };
 
+    // Check whether the univariate is the zero polynomial, i.e. whether all its evaluations are zero
+    bool is_zero() const
+    {
+        for (const auto& eval : evaluations) {
+            if (!eval.is_zero()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     // Write the Univariate evaluations to a buffer
     [[nodiscard]] std::vector<uint8_t> to_buffer() const { return ::to_buffer(evaluations); }
 
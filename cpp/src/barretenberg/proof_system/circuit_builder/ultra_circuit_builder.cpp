@@ -591,15 +591,15 @@ uint32_t UltraCircuitBuilder_<Arithmetization>::put_constant_variable(const FF&
 }
 
 template <typename Arithmetization>
-plookup::BasicTable& UltraCircuitBuilder_<Arithmetization>::get_table(const plookup::BasicTableId id)
+plookup::CircuitBasicTable& UltraCircuitBuilder_<Arithmetization>::get_table(const plookup::BasicTableId id)
 {
-    for (plookup::BasicTable& table : lookup_tables) {
+    for (plookup::CircuitBasicTable& table : lookup_tables) {
         if (table.id == id) {
             return table;
         }
     }
-    // Table doesn't exist! So try to create it.
-    lookup_tables.emplace_back(plookup::create_basic_table(id, lookup_tables.size()));
+    // Table isn't used by the circuit yet! Reference the shared instance, generated on first use by any circuit.
+    lookup_tables.emplace_back(plookup::get_basic_table(id), lookup_tables.size());
     return lookup_tables[lookup_tables.size() - 1];
 }
 
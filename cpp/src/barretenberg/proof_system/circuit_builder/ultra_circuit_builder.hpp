@@ -614,7 +614,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
     // TODO(#216)(Adrian): Why is this not in CircuitBuilderBase
     std::map<FF, uint32_t> constant_variable_indices;
 
-    std::vector<plookup::BasicTable> lookup_tables;
+    std::vector<plookup::CircuitBasicTable> lookup_tables;
     std::vector<plookup::MultiTable> lookup_multi_tables;
     std::map<uint64_t, RangeList> range_lists; // DOCTODO: explain this.
 
@@ -997,7 +997,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization:
                                       bool (*generator)(std::vector<FF>&, std::vector<FF>&, std::vector<FF>&),
                                       std::array<FF, 2> (*get_values_from_key)(const std::array<uint64_t, 2>));
 
-    plookup::BasicTable& get_table(const plookup::BasicTableId id);
+    plookup::CircuitBasicTable& get_table(const plookup::BasicTableId id);
     plookup::MultiTable& create_table(const plookup::MultiTableId id);
 
     plookup::ReadData<uint32_t> create_gates_from_plookup_accumulators(
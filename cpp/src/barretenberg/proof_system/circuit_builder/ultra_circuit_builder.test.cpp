@@ -1,4 +1,5 @@
 #include "ultra_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include <gtest/gtest.h>
 
@@ -103,6 +104,46 @@ TEST(ultra_circuit_constructor, create_gates_from_plookup_accumulators)
     EXPECT_TRUE(saved_state.is_same_state(circuit_builder));
 }
 
+TEST(ultra_circuit_constructor, lookup_tables_are_shared_between_circuits)
+{
+    auto add_xor_lookup = [](UltraCircuitBuilder& builder) {
+        const fr left(engine.get_random_uint32());
+        const fr right(engine.get_random_uint32());
+        const auto sequence_data = plookup::get_lookup_accumulators(MultiTableId::UINT32_XOR, left, right, true);
+        builder.create_gates_from_plookup_accumulators(
+            MultiTableId::UINT32_XOR, sequence_data, builder.add_variable(left), builder.add_variable(right));
+    };
+
+    UltraCircuitBuilder first_builder;
+    UltraCircuitBuilder second_builder;
+    add_xor_lookup(first_builder);
+    add_xor_lookup(second_builder);
+    add_xor_lookup(second_builder);
+
+    ASSERT_EQ(first_builder.lookup_tables.size(), second_builder.lookup_tables.size());
+    for (size_t i = 0; i < first_builder.lookup_tables.size(); ++i) {
+        const auto& first_table = first_builder.lookup_tables[i];
+        const auto& second_table = second_builder.lookup_tables[i];
+        const auto& shared_table = plookup::get_basic_table(first_table.id);
+        EXPECT_EQ(first_table.table_index, i);
+        EXPECT_EQ(first_table.size, shared_table.size);
+        // Both circuits read the columns of the shared table rather than their own copies
+        EXPECT_EQ(first_table.column_1.data(), shared_table.column_1.data());
+        EXPECT_EQ(second_table.column_3.data(), shared_table.column_3.data());
+        EXPECT_EQ(first_table.lookup_gates.size() * 2, second_table.lookup_gates.size());
+    }
+
+    EXPECT_TRUE(first_builder.check_circuit());
+    EXPECT_TRUE(second_builder.check_circuit());
+
+    // Concurrent first uses of a table all see the same instance
+    std::vector<const plookup::BasicTable*> tables(8);
+    parallel_for(tables.size(), [&](size_t i) { tables[i] = &plookup::get_basic_table(plookup::SHA256_BASE28); });
+    for (const auto* table : tables) {
+        EXPECT_EQ(table, tables[0]);
+    }
+}
+
 TEST(ultra_circuit_constructor, base_case)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
@@ -1,6 +1,9 @@
 #include "plookup_tables.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
 
+#include <memory>
+#include <mutex>
+
 namespace bb::plookup {
 
 using namespace bb;
@@ -10,7 +13,11 @@ namespace {
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLES;
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-bool inited = false;
+std::once_flag multi_tables_inited;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<std::unique_ptr<const BasicTable>, BasicTableId::NUM_BASIC_TABLES> BASIC_TABLES;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<std::once_flag, BasicTableId::NUM_BASIC_TABLES> basic_tables_inited;
 
 void init_multi_tables()
 {
@@ -101,13 +108,17 @@ void init_multi_tables()
 
 const MultiTable& create_table(const MultiTableId id)
 {
-    if (!inited) {
-        init_multi_tables();
-        inited = true;
-    }
+    std::call_once(multi_tables_inited, init_multi_tables);
     return MULTI_TABLES[id];
 }
 
+const BasicTable& get_basic_table(const BasicTableId id)
+{
+    std::call_once(basic_tables_inited[id],
+                   [id]() { BASIC_TABLES[id] = std::make_unique<const BasicTable>(create_basic_table(id, 0)); });
+    return *BASIC_TABLES[id];
+}
+
 ReadData<bb::fr> get_lookup_accumulators(const MultiTableId id,
                                          const fr& key_a,
                                          const fr& key_b,
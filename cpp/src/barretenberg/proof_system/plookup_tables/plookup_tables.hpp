@@ -20,6 +20,14 @@ namespace bb::plookup {
 
 const MultiTable& create_table(MultiTableId id);
 
+/**
+ * @brief Get the process-wide instance of a basic table, generating it on first use.
+ *
+ * @details Safe to call from several threads. The table is never modified nor freed, so circuits can reference its
+ * columns instead of holding their own copy. Its table_index is meaningless, circuits number their tables themselves.
+ */
+const BasicTable& get_basic_table(BasicTableId id);
+
 ReadData<bb::fr> get_lookup_accumulators(MultiTableId id,
                                          const bb::fr& key_a,
                                          const bb::fr& key_b = 0,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <span>
 #include <vector>
 
 #include "./fixed_base/fixed_base_params.hpp"
@@ -73,6 +74,7 @@ enum BasicTableId {
     KECCAK_RHO_7,
     KECCAK_RHO_8,
     KECCAK_RHO_9,
+    NUM_BASIC_TABLES,
 };
 
 enum MultiTableId {
@@ -298,6 +300,34 @@ struct BasicTable {
     std::array<bb::fr, 2> (*get_values_from_key)(const std::array<uint64_t, 2>);
 };
 
+/**
+ * @brief A basic table as used by a circuit: its position among the circuit's tables and the lookup gates that read it.
+ *
+ * @details The columns are views into the process-wide table returned by get_basic_table, which is generated once and
+ * never modified, so circuits that use the same tables neither regenerate nor copy them.
+ */
+struct CircuitBasicTable {
+    CircuitBasicTable(const BasicTable& table, const size_t index)
+        : id(table.id)
+        , table_index(index)
+        , size(table.size)
+        , use_twin_keys(table.use_twin_keys)
+        , column_1(table.column_1)
+        , column_2(table.column_2)
+        , column_3(table.column_3)
+    {}
+
+    BasicTableId id;
+    size_t table_index;
+    size_t size;
+    bool use_twin_keys;
+
+    std::span<const bb::fr> column_1;
+    std::span<const bb::fr> column_2;
+    std::span<const bb::fr> column_3;
+    std::vector<BasicTable::KeyEntry> lookup_gates;
+};
+
 enum ColumnIdx { C1, C2, C3 };
 
 /**
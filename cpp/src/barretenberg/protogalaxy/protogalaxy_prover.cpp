@@ -152,11 +152,9 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
 {
     auto combiner_quotient_at_challenge = combiner_quotient.evaluate(challenge);
 
-    // Given the challenge \gamma, compute Z(\gamma) and {L_0(\gamma),L_1(\gamma)}
-    // TODO(https://github.com/AztecProtocol/barretenberg/issues/764): Generalize the vanishing polynomial formula
-    // and the computation of Lagrange basis for k instances
-    auto vanishing_polynomial_at_challenge = challenge * (challenge - FF(1));
-    std::vector<FF> lagranges{ FF(1) - challenge, challenge };
+    // Given the challenge \gamma, compute Z(\gamma) and {L_0(\gamma),...,L_{k-1}(\gamma)}
+    auto [lagranges, vanishing_polynomial_at_challenge] =
+        compute_lagrange_basis_and_vanishing_polynomial<ProverInstances::NUM>(challenge);
 
     auto next_accumulator = std::make_shared<Instance>();
     next_accumulator->is_accumulator = true;
@@ -180,16 +178,18 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
         polynomial = typename Flavor::Polynomial(instances[0]->instance_size);
     }
 
-    // Fold the prover polynomials
+    // Fold the prover polynomials, one range of rows of every polynomial per thread
     auto acc_poly_views = acc_prover_polynomials.get_all();
-    for (size_t inst_idx = 0; inst_idx < ProverInstances::NUM; inst_idx++) {
-        for (auto [acc_poly, inst_poly] :
-             zip_view(acc_prover_polynomials.get_all(), instances[inst_idx]->prover_polynomials.get_all())) {
-            for (auto [acc_el, inst_el] : zip_view(acc_poly, inst_poly)) {
-                acc_el += inst_el * lagranges[inst_idx];
+    const auto columns = instances.get_polynomial_columns();
+    run_loop_in_parallel(instances[0]->instance_size, [&](size_t start, size_t end) {
+        for (auto [acc_poly, column] : zip_view(acc_poly_views, columns)) {
+            for (size_t row = start; row < end; row++) {
+                for (size_t inst_idx = 0; inst_idx < ProverInstances::NUM; inst_idx++) {
+                    acc_poly[row] += column[inst_idx][row] * lagranges[inst_idx];
+                }
             }
         }
-    }
+    });
     next_accumulator->prover_polynomials = std::move(acc_prover_polynomials);
 
     // Fold the witness commtiments and send them to the verifier
@@ -313,4 +313,7 @@ FoldingResult<typename ProverInstances::Flavor> ProtoGalaxyProver_<ProverInstanc
 
 template class ProtoGalaxyProver_<ProverInstances_<honk::flavor::Ultra, 2>>;
 template class ProtoGalaxyProver_<ProverInstances_<honk::flavor::GoblinUltra, 2>>;
+template class ProtoGalaxyProver_<ProverInstances_<honk::flavor::Ultra, 4>>;
+template class ProtoGalaxyProver_<ProverInstances_<honk::flavor::Ultra, 8>>;
+template class ProtoGalaxyProver_<ProverInstances_<honk::flavor::Ultra, 16>>;
 } // namespace bb::honk
\ No newline at end of file
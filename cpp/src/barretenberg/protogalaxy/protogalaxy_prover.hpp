@@ -138,54 +138,58 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
         auto instance_size = instance_polynomials.get_polynomial_size();
 
         std::vector<FF> full_honk_evaluations(instance_size);
-        for (size_t row = 0; row < instance_size; row++) {
-            auto row_evaluations = instance_polynomials.get_row(row);
-            RelationEvaluations relation_evaluations;
-            Utils::zero_elements(relation_evaluations);
-
-            // Note that the evaluations are accumulated with the gate separation challenge being 1 at this stage, as
-            // this specific randomness is added later through the power polynomial univariate specific to ProtoGalaxy
-            Utils::template accumulate_relation_evaluations<>(
-                row_evaluations, relation_evaluations, relation_parameters, FF(1));
-
-            auto output = FF(0);
-            auto running_challenge = FF(1);
-            Utils::scale_and_batch_elements(relation_evaluations, alpha, running_challenge, output);
-
-            full_honk_evaluations[row] = output;
-        }
+        run_loop_in_parallel(instance_size, [&](size_t start, size_t end) {
+            for (size_t row = start; row < end; row++) {
+                auto row_evaluations = instance_polynomials.get_row(row);
+                RelationEvaluations relation_evaluations;
+                Utils::zero_elements(relation_evaluations);
+
+                // Note that the evaluations are accumulated with the gate separation challenge being 1 at this stage,
+                // as this specific randomness is added later through the power polynomial univariate specific to
+                // ProtoGalaxy
+                Utils::template accumulate_relation_evaluations<>(
+                    row_evaluations, relation_evaluations, relation_parameters, FF(1));
+
+                auto output = FF(0);
+                auto running_challenge = FF(1);
+                Utils::scale_and_batch_elements(relation_evaluations, alpha, running_challenge, output);
+
+                full_honk_evaluations[row] = output;
+            }
+        });
         return full_honk_evaluations;
     }
 
+    // The largest instance size, as a power of two, whose perturbator we can construct
+    static constexpr size_t MAX_LOG_INSTANCE_SIZE = 32;
+
     /**
-     * @brief  Recursively compute the parent nodes of each level in there, starting from the leaves. Note that at each
-     * level, the resulting parent nodes will be polynomials of degree (level + 1) because we multiply by an additional
-     * factor of X.
+     * @brief Compute one level of the perturbator coefficients tree in place. The children are polynomials of degree
+     * `level`, stored one after the other from `nodes` onwards; the parents, of degree `level + 1`, are written over
+     * them from `nodes` onwards. Each parent is computed as n = n_l + n_r * (β + δ X).
      */
-    static std::vector<FF> construct_coefficients_tree(const std::vector<FF>& betas,
-                                                       const std::vector<FF>& deltas,
-                                                       const std::vector<std::vector<FF>>& prev_level_coeffs,
-                                                       size_t level = 1)
+    static void construct_coefficients_tree_level(
+        FF* nodes, const size_t num_parents, const size_t level, const FF& beta, const FF& delta)
     {
-        // if we are at level t in the tree, where t = logn and n is the instance size, we have reached the root which
-        // contains the coefficients of the perturbator polynomial
-        if (level == betas.size()) {
-            return prev_level_coeffs[0];
-        }
-
-        auto degree = level + 1;
-        auto prev_level_width = prev_level_coeffs.size();
-        // we need degree + 1 terms to represent the intermediate polynomials
-        std::vector<std::vector<FF>> level_coeffs(prev_level_width >> 1, std::vector<FF>(degree + 1, 0));
-        for (size_t node = 0; node < prev_level_width; node += 2) {
-            auto parent = node >> 1;
-            std::copy(prev_level_coeffs[node].begin(), prev_level_coeffs[node].end(), level_coeffs[parent].begin());
-            for (size_t d = 0; d < degree; d++) {
-                level_coeffs[parent][d] += prev_level_coeffs[node + 1][d] * betas[level];
-                level_coeffs[parent][d + 1] += prev_level_coeffs[node + 1][d] * deltas[level];
+        const size_t child_size = level + 1;
+        const size_t parent_size = level + 2;
+        // A parent overlaps its children, so build it on the side before writing it back
+        std::array<FF, MAX_LOG_INSTANCE_SIZE + 1> parent;
+        for (size_t node = 0; node < num_parents; node++) {
+            const FF* left = nodes + (2 * node * child_size);
+            const FF* right = left + child_size;
+            for (size_t d = 0; d < child_size; d++) {
+                parent[d] = left[d] + right[d] * beta;
+            }
+            parent[child_size] = 0;
+            for (size_t d = 0; d < child_size; d++) {
+                parent[d + 1] += right[d] * delta;
+            }
+            // the parent ends before the children of the next parent start, so we never clobber a node we still need
+            for (size_t d = 0; d < parent_size; d++) {
+                nodes[node * parent_size + d] = parent[d];
             }
         }
-        return construct_coefficients_tree(betas, deltas, level_coeffs, level + 1);
     }
 
     /**
@@ -195,21 +199,46 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
      * the tree, label the branch connecting the left node n_l to its parent by 1 and for the right node n_r by β_i +
      * δ_i X. The value of the parent node n will be constructed as n = n_l + n_r * (β_i + δ_i X). Recurse over each
      * layer until the root is reached which will correspond to the perturbator polynomial F(X).
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/745): make computation of perturbator more memory
-     * efficient, operate in-place and use std::resize; add multithreading
+     *
+     * @details A level of n nodes of degree i takes up n * (i + 1) field elements, which never exceeds the number of
+     * leaves, so the whole tree is reduced in place in the memory of the leaves. The leaves are split into one
+     * contiguous slice per thread, the subtrees over the slices are reduced in parallel and the few levels above them
+     * are reduced on a single thread.
      */
     static std::vector<FF> construct_perturbator_coefficients(const std::vector<FF>& betas,
                                                               const std::vector<FF>& deltas,
-                                                              const std::vector<FF>& full_honk_evaluations)
+                                                              std::vector<FF> full_honk_evaluations)
     {
-        auto width = full_honk_evaluations.size();
-        std::vector<std::vector<FF>> first_level_coeffs(width >> 1, std::vector<FF>(2, 0));
-        for (size_t node = 0; node < width; node += 2) {
-            auto parent = node >> 1;
-            first_level_coeffs[parent][0] = full_honk_evaluations[node] + full_honk_evaluations[node + 1] * betas[0];
-            first_level_coeffs[parent][1] = full_honk_evaluations[node + 1] * deltas[0];
+        const size_t log_width = betas.size();
+        const size_t width = full_honk_evaluations.size();
+        ASSERT(width == (static_cast<size_t>(1) << log_width));
+        ASSERT(log_width <= MAX_LOG_INSTANCE_SIZE);
+        FF* nodes = full_honk_evaluations.data();
+
+        const size_t num_slices = std::max(std::min(get_num_cpus_pow2(), width >> 1), static_cast<size_t>(1));
+        const size_t slice_width = width / num_slices;
+        const size_t log_slice_width = numeric::get_msb(slice_width);
+        parallel_for(num_slices, [&](size_t slice) {
+            FF* slice_nodes = nodes + slice * slice_width;
+            for (size_t level = 0; level < log_slice_width; level++) {
+                construct_coefficients_tree_level(
+                    slice_nodes, slice_width >> (level + 1), level, betas[level], deltas[level]);
+            }
+        });
+
+        // Gather the roots of the slices, which each have log_slice_width + 1 coefficients, next to each other
+        const size_t slice_root_size = log_slice_width + 1;
+        for (size_t slice = 1; slice < num_slices; slice++) {
+            for (size_t d = 0; d < slice_root_size; d++) {
+                nodes[slice * slice_root_size + d] = nodes[slice * slice_width + d];
+            }
         }
-        return construct_coefficients_tree(betas, deltas, first_level_coeffs);
+        for (size_t level = log_slice_width; level < log_width; level++) {
+            construct_coefficients_tree_level(nodes, width >> (level + 1), level, betas[level], deltas[level]);
+        }
+
+        full_honk_evaluations.resize(log_width + 1);
+        return full_honk_evaluations;
     }
 
     /**
@@ -225,27 +254,37 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
             accumulator->prover_polynomials, accumulator->alphas, accumulator->relation_parameters);
         const auto betas = accumulator->gate_challenges;
         assert(betas.size() == deltas.size());
-        auto coeffs = construct_perturbator_coefficients(betas, deltas, full_honk_evaluations);
+        auto coeffs = construct_perturbator_coefficients(betas, deltas, std::move(full_honk_evaluations));
         return Polynomial<FF>(coeffs);
     }
 
     TupleOfTuplesOfUnivariates univariate_accumulators;
 
     /**
-     * @brief Prepare a univariate polynomial for relation execution in one step of the main loop in folded instance
+     * @brief Prepare the univariate polynomials for relation execution in one step of the main loop in folded instance
      * construction.
-     * @details For a fixed prover polynomial index, extract that polynomial from each instance in Instances. From each
-     * polynomial, extract the value at row_idx. Use these values to create a univariate polynomial, and then extend
-     * (i.e., compute additional evaluations at adjacent domain values) as needed.
+     * @details For each prover polynomial, read the value at row_idx out of each instance to create a univariate
+     * polynomial, and then extend it (i.e., compute additional evaluations at adjacent domain values) as needed. A
+     * polynomial that takes the same value in every instance, as the precomputed polynomials do when instances of the
+     * same circuit are folded, extends to a constant so the barycentric extension is skipped.
      * @todo TODO(https://github.com/AztecProtocol/barretenberg/issues/751) Optimize memory
      */
-    void extend_univariates(ExtendedUnivariates& extended_univariates,
-                            const ProverInstances& instances,
-                            const size_t row_idx)
+    static void extend_univariates(auto& extended_univariates,
+                                   const typename ProverInstances::PolynomialColumns& columns,
+                                   const size_t row_idx)
     {
-        auto base_univariates = instances.row_to_univariates(row_idx);
-        for (auto [extended_univariate, base_univariate] : zip_view(extended_univariates.get_all(), base_univariates)) {
-            extended_univariate = base_univariate.template extend_to<ExtendedUnivariate::LENGTH>();
+        for (auto [extended_univariate, column] : zip_view(extended_univariates, columns)) {
+            BaseUnivariate base_univariate;
+            bool is_constant = true;
+            for (size_t instance_idx = 0; instance_idx < ProverInstances::NUM; instance_idx++) {
+                base_univariate.value_at(instance_idx) = column[instance_idx][row_idx];
+                is_constant = is_constant && (base_univariate.value_at(instance_idx) == base_univariate.value_at(0));
+            }
+            if (is_constant) {
+                extended_univariate = ExtendedUnivariate(base_univariate.value_at(0));
+            } else {
+                extended_univariate = base_univariate.template extend_to<ExtendedUnivariate::LENGTH>();
+            }
         }
     }
 
@@ -256,8 +295,20 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
                                          const FF& scaling_factor)
     {
         using Relation = std::tuple_element_t<relation_idx, Relations>;
-        Relation::accumulate(
-            std::get<relation_idx>(univariate_accumulators), extended_univariates, relation_parameters, scaling_factor);
+        // A relation whose selector vanishes on this row in every instance contributes zero to the combiner
+        if constexpr (bb::isSkippable<Relation, ExtendedUnivariates>) {
+            if (!Relation::skip(extended_univariates)) {
+                Relation::accumulate(std::get<relation_idx>(univariate_accumulators),
+                                     extended_univariates,
+                                     relation_parameters,
+                                     scaling_factor);
+            }
+        } else {
+            Relation::accumulate(std::get<relation_idx>(univariate_accumulators),
+                                 extended_univariates,
+                                 relation_parameters,
+                                 scaling_factor);
+        }
 
         // Repeat for the next relation.
         if constexpr (relation_idx + 1 < Flavor::NUM_RELATIONS) {
@@ -295,14 +346,17 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
         std::vector<ExtendedUnivariates> extended_univariates;
         extended_univariates.resize(num_threads);
 
+        const auto columns = instances.get_polynomial_columns();
+
         // Accumulate the contribution from each sub-relation
         parallel_for(num_threads, [&](size_t thread_idx) {
             size_t start = thread_idx * iterations_per_thread;
             size_t end = (thread_idx + 1) * iterations_per_thread;
+            auto extended_univariate_views = extended_univariates[thread_idx].get_all();
 
             for (size_t idx = start; idx < end; idx++) {
                 // No need to initialise extended_univariates to 0, it's assigned to
-                extend_univariates(extended_univariates[thread_idx], instances, idx);
+                extend_univariates(extended_univariate_views, columns, idx);
 
                 FF pow_challenge = pow_betas[idx];
 
@@ -347,24 +401,41 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     /**
      * @brief Compute the combiner quotient defined as $K$ polynomial in the paper.
      *
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/764): generalize the computation of vanishing
-     * polynomials and Lagrange basis and use batch_invert.
-     *
+     * @details K(X) = (G(X) - F(α) * L_0(X)) / Z(X) is computed as evaluations on the points outside of the instance
+     * domain {0, ..., k - 1}. At such a point j, L_0(j) = Π_{i=1}^{k-1} (j - i) / (-i) and Z(j) = j * Π_{i=1}^{k-1} (j - i)
+     * share a product, and the inverses of Z(j) are computed in one batch.
      */
     static Univariate<FF, ProverInstances::BATCHED_EXTENDED_LENGTH, ProverInstances::NUM> compute_combiner_quotient(
         const FF compressed_perturbator, ExtendedUnivariateWithRandomization combiner)
     {
-        std::array<FF, ProverInstances::BATCHED_EXTENDED_LENGTH - ProverInstances::NUM> combiner_quotient_evals = {};
+        constexpr size_t NUM_EVALUATIONS = ProverInstances::BATCHED_EXTENDED_LENGTH - ProverInstances::NUM;
+        std::array<FF, NUM_EVALUATIONS> combiner_quotient_evals = {};
+        std::array<FF, NUM_EVALUATIONS> lagrange_0_numerators;
+        std::array<FF, NUM_EVALUATIONS> vanishing_polynomial_inverses;
+
+        // The denominator Π_{i=1}^{k-1} (-i) of L_0
+        FF lagrange_0_denominator = 1;
+        for (size_t i = 1; i < ProverInstances::NUM; i++) {
+            lagrange_0_denominator *= -FF(i);
+        }
+        const FF lagrange_0_denominator_inverse = lagrange_0_denominator.invert();
 
-        // Compute the combiner quotient polynomial as evaluations on points that are not in the vanishing set.
-        //
         for (size_t point = ProverInstances::NUM; point < combiner.size(); point++) {
             auto idx = point - ProverInstances::NUM;
-            auto lagrange_0 = FF(1) - FF(point);
-            auto vanishing_polynomial = FF(point) * (FF(point) - 1);
+            lagrange_0_numerators[idx] = 1;
+            for (size_t i = 1; i < ProverInstances::NUM; i++) {
+                lagrange_0_numerators[idx] *= FF(point) - FF(i);
+            }
+            vanishing_polynomial_inverses[idx] = FF(point) * lagrange_0_numerators[idx];
+        }
+        FF::batch_invert(vanishing_polynomial_inverses);
 
+        // Compute the combiner quotient polynomial as evaluations on points that are not in the vanishing set.
+        for (size_t point = ProverInstances::NUM; point < combiner.size(); point++) {
+            auto idx = point - ProverInstances::NUM;
+            auto lagrange_0 = lagrange_0_numerators[idx] * lagrange_0_denominator_inverse;
             combiner_quotient_evals[idx] =
-                (combiner.value_at(point) - compressed_perturbator * lagrange_0) * vanishing_polynomial.invert();
+                (combiner.value_at(point) - compressed_perturbator * lagrange_0) * vanishing_polynomial_inverses[idx];
         }
 
         Univariate<FF, ProverInstances::BATCHED_EXTENDED_LENGTH, ProverInstances::NUM> combiner_quotient(
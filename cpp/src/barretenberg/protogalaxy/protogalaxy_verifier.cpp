@@ -174,8 +174,8 @@ bool ProtoGalaxyVerifier_<VerifierInstances>::verify_folding_proof(std::vector<u
     FF combiner_challenge = transcript->get_challenge("combiner_quotient_challenge");
     auto combiner_quotient_at_challenge = combiner_quotient.evaluate(combiner_challenge);
 
-    auto vanishing_polynomial_at_challenge = combiner_challenge * (combiner_challenge - FF(1));
-    auto lagranges = std::vector<FF>{ FF(1) - combiner_challenge, combiner_challenge };
+    auto [lagranges, vanishing_polynomial_at_challenge] =
+        compute_lagrange_basis_and_vanishing_polynomial<VerifierInstances::NUM>(combiner_challenge);
 
     // Compute next folding parameters and verify against the ones received from the prover
     auto expected_next_target_sum =
@@ -275,4 +275,7 @@ bool ProtoGalaxyVerifier_<VerifierInstances>::verify_folding_proof(std::vector<u
 
 template class ProtoGalaxyVerifier_<VerifierInstances_<honk::flavor::Ultra, 2>>;
 template class ProtoGalaxyVerifier_<VerifierInstances_<honk::flavor::GoblinUltra, 2>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<honk::flavor::Ultra, 4>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<honk::flavor::Ultra, 8>>;
+template class ProtoGalaxyVerifier_<VerifierInstances_<honk::flavor::Ultra, 16>>;
 } // namespace bb::honk
\ No newline at end of file
@@ -31,6 +31,20 @@ concept HasSubrelationLinearlyIndependentMember = requires(T) {
 template <typename T>
 concept HasParameterLengthAdjustmentsMember = requires { T::TOTAL_LENGTH_ADJUSTMENTS; };
 
+/**
+ * @brief Check whether a relation can tell from its inputs that its contribution is zero.
+ *
+ * @details Most relations are scaled by a selector that vanishes on the rows that are not gates of that type, e.g.
+ * padding or the rows of other gate types. Such a relation defines a `skip` method, which returns true only if all of
+ * its subrelations are identically zero on the given input, so the prover can avoid accumulating it there.
+ */
+template <typename Relation, typename AllEntities>
+concept isSkippable = requires(const AllEntities& input) {
+                          {
+                              Relation::skip(input)
+                              } -> std::same_as<bool>;
+                      };
+
 /**
  * @brief Check whether a given subrelation is linearly independent from the other subrelations.
  *
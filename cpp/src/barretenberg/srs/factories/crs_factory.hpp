@@ -4,7 +4,10 @@
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/bn254/g2.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_point_table.hpp"
 #include <cstddef>
+#include <memory>
+#include <mutex>
 
 namespace bb::pairing {
 struct miller_lines;
@@ -25,6 +28,26 @@ template <typename Curve> class ProverCrs {
      */
     virtual typename Curve::AffineElement* get_monomial_points() = 0;
     virtual size_t get_monomial_size() const = 0;
+
+    /**
+     * @brief Returns precomputed multiples of the monomial points, for fixed-base scalar multiplications.
+     * @details The table is built on first request and cached, so that it is shared by everyone using this crs. It is
+     * rebuilt if requested with a different memory budget.
+     */
+    std::shared_ptr<scalar_multiplication::fixed_base_point_table<Curve>> get_fixed_base_point_table(
+        size_t max_table_bytes)
+    {
+        std::lock_guard<std::mutex> lock(fixed_base_point_table_mutex);
+        if (!fixed_base_point_table || fixed_base_point_table->max_table_bytes != max_table_bytes) {
+            fixed_base_point_table = std::make_shared<scalar_multiplication::fixed_base_point_table<Curve>>(
+                get_monomial_points(), get_monomial_size(), max_table_bytes);
+        }
+        return fixed_base_point_table;
+    }
+
+  private:
+    std::mutex fixed_base_point_table_mutex;
+    std::shared_ptr<scalar_multiplication::fixed_base_point_table<Curve>> fixed_base_point_table;
 };
 
 template <typename Curve> class VerifierCrs {
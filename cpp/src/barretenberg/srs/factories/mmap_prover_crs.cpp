@@ -0,0 +1,90 @@
+#include "mmap_prover_crs.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+
+#include <fstream>
+#include <string>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+namespace bb::srs::factories {
+
+namespace {
+template <typename Curve> PointTableCacheHeader get_expected_header(const size_t num_points)
+{
+    return { PointTableCacheHeader::MAGIC,
+             PointTableCacheHeader::VERSION,
+             Curve::BaseField::modulus.data[0],
+             sizeof(typename Curve::AffineElement),
+             num_points,
+             {} };
+}
+
+template <typename Curve> bool is_compatible_header(PointTableCacheHeader const& header)
+{
+    const auto expected = get_expected_header<Curve>(header.num_points);
+    return header.magic == expected.magic && header.version == expected.version &&
+           header.curve_id == expected.curve_id && header.point_size == expected.point_size;
+}
+} // namespace
+
+template <typename Curve>
+MmapProverCrs<Curve>::MmapProverCrs(std::string const& cache_path, const size_t num_points)
+    : num_points(num_points)
+{
+    const size_t cache_size = get_cache_size(cache_path);
+    if (cache_size < num_points) {
+        throw_or_abort(format(
+            "Point table cache ", cache_path, " holds ", cache_size, " points, but ", num_points, " were requested."));
+    }
+
+    // We only map the part of the table we need
+    file_ = std::make_unique<MappedFile>(cache_path,
+                                         MappedFile::Access::READ_ONLY,
+                                         "point table cache",
+                                         sizeof(PointTableCacheHeader) + (num_points * 2 * sizeof(AffineElement)));
+    monomials_ = reinterpret_cast<AffineElement*>(file_->data() + sizeof(PointTableCacheHeader));
+}
+
+template <typename Curve> size_t MmapProverCrs<Curve>::get_cache_size(std::string const& cache_path)
+{
+    std::ifstream file(cache_path, std::ifstream::binary);
+    if (!file.good()) {
+        return 0;
+    }
+    PointTableCacheHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(PointTableCacheHeader));
+    if (!file || !is_compatible_header<Curve>(header)) {
+        return 0;
+    }
+    // guard against truncated files, which would fault when the missing pages are accessed
+    file.seekg(0, std::ifstream::end);
+    const auto file_size = static_cast<size_t>(file.tellg());
+    if (file_size < sizeof(PointTableCacheHeader) + (header.num_points * 2 * sizeof(AffineElement))) {
+        return 0;
+    }
+    return header.num_points;
+}
+
+template <typename Curve>
+void MmapProverCrs<Curve>::write_cache(std::string const& cache_path,
+                                       AffineElement const* points,
+                                       const size_t num_points)
+{
+    auto point_table = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    std::copy(points, points + num_points, point_table.get());
+    scalar_multiplication::generate_pippenger_point_table<Curve>(point_table.get(), point_table.get(), num_points);
+
+    const auto header = get_expected_header<Curve>(num_points);
+    write_file_atomically(cache_path, "point table cache", [&](std::ofstream& file) {
+        file.write(reinterpret_cast<char const*>(&header), sizeof(PointTableCacheHeader));
+        file.write(reinterpret_cast<char const*>(point_table.get()),
+                   static_cast<std::streamsize>(num_points * 2 * sizeof(AffineElement)));
+    });
+}
+
+template class MmapProverCrs<curve::BN254>;
+template class MmapProverCrs<curve::Grumpkin>;
+
+} // namespace bb::srs::factories
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
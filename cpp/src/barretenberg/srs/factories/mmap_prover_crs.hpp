@@ -0,0 +1,79 @@
+#pragma once
+#include "barretenberg/common/mapped_file.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "crs_factory.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace bb::srs::factories {
+
+/**
+ * @brief Header of a point table cache file.
+ *
+ * @details A point table cache holds a prover SRS in the exact form the prover uses it: the pippenger point table
+ * (each point followed by its endomorphism image, see `generate_pippenger_point_table`), with coordinates in native
+ * Montgomery form. The file consists of this header followed by `2 * num_points` affine elements. The header takes up
+ * a full cache line, so the mapped points are aligned to the cache line and to the point size.
+ */
+struct PointTableCacheHeader {
+    static constexpr uint64_t MAGIC = 0x454c424154544e50; // "PNTTABLE"
+    static constexpr uint64_t VERSION = 2;
+
+    uint64_t magic;
+    uint64_t version;
+    // the lowest limb of the base field modulus, to distinguish between curves
+    uint64_t curve_id;
+    uint64_t point_size;
+    uint64_t num_points;
+    std::array<uint64_t, 3> padding;
+};
+static_assert(sizeof(PointTableCacheHeader) == 64);
+
+/**
+ * @brief A prover crs backed by a read-only memory mapping of a point table cache file.
+ *
+ * @details Constructing the crs is O(1): there is no transcript parsing, no Montgomery conversion and no endomorphism
+ * table to compute, and pages are only loaded as the prover touches them. As the mapping is shared, every prover
+ * process on a host that uses the same cache file shares a single resident copy of the SRS.
+ *
+ * The points are mapped read-only, so anything that tries to modify them will fault.
+ */
+template <typename Curve> class MmapProverCrs : public ProverCrs<Curve> {
+    using AffineElement = typename Curve::AffineElement;
+
+  public:
+    /**
+     * @param cache_path path to a point table cache holding at least `num_points` points
+     * @param num_points the number of srs points to expose
+     */
+    MmapProverCrs(std::string const& cache_path, size_t num_points);
+
+    AffineElement* get_monomial_points() override { return monomials_; }
+
+    [[nodiscard]] size_t get_monomial_size() const override { return num_points; }
+
+    /**
+     * @brief Returns the number of srs points held by the point table cache at `cache_path`, or 0 if there is no
+     * valid cache for this curve.
+     */
+    static size_t get_cache_size(std::string const& cache_path);
+
+    /**
+     * @brief Writes a point table cache for the srs points `points[0], ..., points[num_points - 1]`.
+     *
+     * @details The cache is written to a temporary file which is then renamed to `cache_path`, so processes that are
+     * concurrently reading (or have mapped) an older cache are unaffected.
+     */
+    static void write_cache(std::string const& cache_path, AffineElement const* points, size_t num_points);
+
+  private:
+    size_t num_points;
+    std::unique_ptr<MappedFile> file_;
+    AffineElement* monomials_;
+};
+
+} // namespace bb::srs::factories
@@ -0,0 +1,85 @@
+#include "barretenberg/srs/factories/mmap_prover_crs.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/srs/factories/mem_prover_crs.hpp"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace bb;
+using namespace bb::srs::factories;
+using namespace curve;
+
+template <typename Curve> class MmapProverCrsTest : public ::testing::Test {
+  public:
+    static std::string get_cache_path()
+    {
+        const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        // typed test suite names contain a '/'
+        std::string file_name = std::string(test_info->test_suite_name()) + "_" + test_info->name() + ".dat";
+        std::replace(file_name.begin(), file_name.end(), '/', '_');
+        return (std::filesystem::temp_directory_path() / file_name).string();
+    }
+};
+
+using Curves = ::testing::Types<BN254, Grumpkin>;
+TYPED_TEST_SUITE(MmapProverCrsTest, Curves);
+
+TYPED_TEST(MmapProverCrsTest, MatchesMemProverCrs)
+{
+    using Curve = TypeParam;
+    using AffineElement = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+    constexpr size_t num_points = 1024;
+
+    std::vector<AffineElement> points(num_points);
+    for (auto& point : points) {
+        point = AffineElement(Element::random_element());
+    }
+    const auto cache_path = TestFixture::get_cache_path();
+
+    EXPECT_EQ(MmapProverCrs<Curve>::get_cache_size(cache_path), 0UL);
+    MmapProverCrs<Curve>::write_cache(cache_path, points.data(), num_points);
+    EXPECT_EQ(MmapProverCrs<Curve>::get_cache_size(cache_path), num_points);
+
+    MemProverCrs<Curve> mem_crs(points);
+    // a cache can back a crs of any smaller size
+    for (const size_t crs_size : { num_points, num_points / 2 }) {
+        MmapProverCrs<Curve> mmap_crs(cache_path, crs_size);
+        EXPECT_EQ(mmap_crs.get_monomial_size(), crs_size);
+        // the points start on a cache line
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(mmap_crs.get_monomial_points()) % 64, 0UL);
+        EXPECT_EQ(memcmp(mmap_crs.get_monomial_points(),
+                         mem_crs.get_monomial_points(),
+                         sizeof(AffineElement) * crs_size * 2),
+                  0);
+    }
+    std::filesystem::remove(cache_path);
+}
+
+TYPED_TEST(MmapProverCrsTest, RejectsInvalidCaches)
+{
+    using Curve = TypeParam;
+    using OtherCurve = std::conditional_t<std::same_as<Curve, BN254>, Grumpkin, BN254>;
+    using AffineElement = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+    constexpr size_t num_points = 16;
+
+    std::vector<AffineElement> points(num_points, AffineElement(Element::random_element()));
+    const auto cache_path = TestFixture::get_cache_path();
+
+    // a cache for the other curve
+    std::vector<typename OtherCurve::AffineElement> other_points(num_points, OtherCurve::AffineElement::one());
+    MmapProverCrs<OtherCurve>::write_cache(cache_path, other_points.data(), num_points);
+    EXPECT_EQ(MmapProverCrs<OtherCurve>::get_cache_size(cache_path), num_points);
+    EXPECT_EQ(MmapProverCrs<Curve>::get_cache_size(cache_path), 0UL);
+
+    // a truncated cache
+    MmapProverCrs<Curve>::write_cache(cache_path, points.data(), num_points);
+    std::filesystem::resize_file(cache_path, sizeof(PointTableCacheHeader) + sizeof(AffineElement) * num_points);
+    EXPECT_EQ(MmapProverCrs<Curve>::get_cache_size(cache_path), 0UL);
+
+    std::filesystem::remove(cache_path);
+}
@@ -12,6 +12,10 @@ void init_grumpkin_crs_factory(std::string crs_path);
 void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const& points);
 void init_crs_factory(std::vector<bb::g1::affine_element> const& points, bb::g2::affine_element const g2_point);
 
+// Initializes the crs using an existing prover crs (e.g. a memory-mapped point table cache, see MmapProverCrs)
+void init_crs_factory_with_prover_crs(std::shared_ptr<bb::srs::factories::ProverCrs<curve::BN254>> prover_crs,
+                                      bb::g2::affine_element const g2_point);
+
 std::shared_ptr<bb::srs::factories::CrsFactory<curve::BN254>> get_crs_factory();
 std::shared_ptr<bb::srs::factories::CrsFactory<curve::Grumpkin>> get_grumpkin_crs_factory();
 
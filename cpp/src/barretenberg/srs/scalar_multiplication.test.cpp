@@ -967,6 +967,194 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeShortInputs)
     EXPECT_EQ(result == expected, true);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, PippengerFixedBase)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+    // not a power of two, so that the input is split into several slices
+    constexpr size_t num_msm_points = num_points - 1000;
+
+    std::vector<Fr> scalars(num_points);
+    auto points = bb::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    // mix random, zero and short scalars
+    for (size_t i = 0; i < num_points; ++i) {
+        switch (i % 4) {
+        case 0:
+            scalars[i] = Fr::random_element();
+            break;
+        case 1:
+            scalars[i] = Fr::zero();
+            break;
+        case 2:
+            scalars[i] = Fr(engine.get_random_uint32());
+            break;
+        default:
+            scalars[i] = Fr(engine.get_random_uint32() & 0x07U);
+        }
+    }
+
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_msm_points; ++i) {
+        Element temp = points[i] * scalars[i];
+        expected += temp;
+    }
+    expected = expected.normalize();
+    bb::scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+    bb::scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+
+    // a table with a window per round, and a memory-constrained table with two windows
+    const size_t window_bytes = sizeof(AffineElement) * num_points * 2;
+    for (const size_t max_table_bytes : { static_cast<size_t>(1ULL << 32), window_bytes * 2 }) {
+        bb::scalar_multiplication::fixed_base_point_table<Curve> table(points.get(), num_points, max_table_bytes);
+        EXPECT_LE(table.num_windows * window_bytes, max_table_bytes);
+        if (max_table_bytes == window_bytes * 2) {
+            EXPECT_GT(table.get_num_passes(), 1UL);
+        } else {
+            EXPECT_EQ(table.get_num_passes(), 1UL);
+        }
+
+        Element result = bb::scalar_multiplication::pippenger_fixed_base<Curve>(
+            &scalars[0], table, num_msm_points, state);
+        EXPECT_EQ(result.normalize(), expected);
+
+        result = bb::scalar_multiplication::pippenger_fixed_base_unsafe<Curve>(
+            &scalars[0], table, num_msm_points, state);
+        EXPECT_EQ(result.normalize(), expected);
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerBatch)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+    // not a power of two, so that the input is split into several slices
+    constexpr size_t num_msm_points = num_points - 1000;
+    constexpr size_t num_polynomials = 3;
+
+    auto points = bb::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+
+    // a dense polynomial, a sparse one and one with short coefficients
+    std::vector<std::vector<Fr>> polynomials(num_polynomials, std::vector<Fr>(num_msm_points));
+    for (size_t i = 0; i < num_msm_points; ++i) {
+        polynomials[0][i] = Fr::random_element();
+        polynomials[1][i] = (i % 16 == 0) ? Fr::random_element() : Fr::zero();
+        polynomials[2][i] = Fr(engine.get_random_uint32() & 0xffU);
+    }
+
+    std::vector<Element> expected(num_polynomials);
+    for (size_t k = 0; k < num_polynomials; ++k) {
+        expected[k].self_set_infinity();
+        for (size_t i = 0; i < num_msm_points; ++i) {
+            Element temp = points[i] * polynomials[k][i];
+            expected[k] += temp;
+        }
+        expected[k] = expected[k].normalize();
+    }
+
+    bb::scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+    bb::scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+
+    std::vector<const Fr*> scalars;
+    for (const auto& polynomial : polynomials) {
+        scalars.emplace_back(polynomial.data());
+    }
+    std::vector<Element> results =
+        bb::scalar_multiplication::pippenger_batch<Curve>(scalars, points.get(), num_msm_points, state);
+    ASSERT_EQ(results.size(), num_polynomials);
+    for (size_t k = 0; k < num_polynomials; ++k) {
+        EXPECT_EQ(results[k].normalize(), expected[k]);
+    }
+
+    results = bb::scalar_multiplication::pippenger_batch_unsafe<Curve>(scalars, points.get(), num_msm_points, state);
+    for (size_t k = 0; k < num_polynomials; ++k) {
+        EXPECT_EQ(results[k].normalize(), expected[k]);
+    }
+
+    // small chunks, so that the batch is bucketed against several chunks of the points
+    results = bb::scalar_multiplication::pippenger_batch<Curve>(
+        scalars, points.get(), num_msm_points, state, /*handle_edge_cases=*/true, /*max_chunk_points=*/1024);
+    for (size_t k = 0; k < num_polynomials; ++k) {
+        EXPECT_EQ(results[k].normalize(), expected[k]);
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerSparse)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+
+    auto points = bb::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+
+    // a sparse vector, which is compacted, and a vector that is too dense to be worth compacting
+    std::vector<Fr> sparse_scalars(num_points, Fr::zero());
+    std::vector<Fr> dense_scalars(num_points, Fr::zero());
+    for (size_t i = 0; i < num_points; ++i) {
+        if (i % 32 == 5) {
+            sparse_scalars[i] = Fr::random_element();
+        } else if (i % 32 == 17) {
+            sparse_scalars[i] = Fr(engine.get_random_uint32() & 0x0fU);
+        }
+        if (i % 4 != 0) {
+            dense_scalars[i] = Fr::random_element();
+        }
+    }
+
+    Element expected_sparse;
+    Element expected_dense;
+    expected_sparse.self_set_infinity();
+    expected_dense.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        Element temp = points[i] * sparse_scalars[i];
+        expected_sparse += temp;
+        temp = points[i] * dense_scalars[i];
+        expected_dense += temp;
+    }
+    expected_sparse = expected_sparse.normalize();
+    expected_dense = expected_dense.normalize();
+
+    bb::scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+    bb::scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+
+    Element result =
+        bb::scalar_multiplication::pippenger_sparse<Curve>(&sparse_scalars[0], points.get(), num_points, state);
+    EXPECT_EQ(result.normalize(), expected_sparse);
+
+    result =
+        bb::scalar_multiplication::pippenger_sparse_unsafe<Curve>(&sparse_scalars[0], points.get(), num_points, state);
+    EXPECT_EQ(result.normalize(), expected_sparse);
+
+    result = bb::scalar_multiplication::pippenger_sparse<Curve>(&dense_scalars[0], points.get(), num_points, state);
+    EXPECT_EQ(result.normalize(), expected_dense);
+
+    // all zero
+    std::vector<Fr> zero_scalars(num_points, Fr::zero());
+    result = bb::scalar_multiplication::pippenger_sparse<Curve>(&zero_scalars[0], points.get(), num_points, state);
+    EXPECT_TRUE(result.is_point_at_infinity());
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerOne)
 {
     using Curve = TypeParam;
@@ -0,0 +1,304 @@
+#include "file_store.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+namespace bb::stdlib::merkle_tree {
+
+namespace {
+constexpr size_t RECORD_HEADER_SIZE = 2 * sizeof(uint32_t);
+constexpr size_t INITIAL_LOG_SIZE = 1UL << 20;
+constexpr uint64_t INITIAL_NUM_SLOTS = 1UL << 12;
+
+// FNV-1a, keys are mostly hashes already
+uint64_t hash_key(std::string_view key)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const char c : key) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::pair<uint32_t, uint32_t> read_record_header(uint8_t const* record)
+{
+    uint32_t key_size = 0;
+    uint32_t value_size = 0;
+    std::memcpy(&key_size, record, sizeof(uint32_t));
+    std::memcpy(&value_size, record + sizeof(uint32_t), sizeof(uint32_t));
+    return { key_size, value_size };
+}
+
+size_t get_record_size(uint32_t key_size, uint32_t value_size)
+{
+    return RECORD_HEADER_SIZE + key_size + (value_size == FileStoreHeader::DELETED ? 0 : value_size);
+}
+} // namespace
+
+FileStore::FileStore(std::string const& path, const size_t cache_size)
+    : log_(std::make_unique<MappedFile>(path, MappedFile::Access::READ_WRITE, "merkle tree store"))
+    , cache_size_(cache_size)
+{
+    if (log_->size() == 0) {
+        log_->resize(INITIAL_LOG_SIZE);
+        header() = { FileStoreHeader::MAGIC, FileStoreHeader::VERSION, 0 };
+        log_->sync(0, sizeof(FileStoreHeader));
+    }
+    if (log_->size() < sizeof(FileStoreHeader) || header().magic != FileStoreHeader::MAGIC ||
+        header().version != FileStoreHeader::VERSION) {
+        throw_or_abort(format("Merkle tree store ", path, " has an unsupported format."));
+    }
+    if (sizeof(FileStoreHeader) + header().committed_size > log_->size()) {
+        throw_or_abort(format("Merkle tree store ", path, " is truncated."));
+    }
+
+    index_ = std::make_unique<MappedFile>(path + ".index", MappedFile::Access::READ_WRITE, "merkle tree store");
+    const bool index_is_valid =
+        index_->size() >= sizeof(FileStoreIndexHeader) && index_header().magic == FileStoreIndexHeader::MAGIC &&
+        index_header().version == FileStoreIndexHeader::VERSION &&
+        index_header().committed_size == header().committed_size &&
+        index_->size() >= sizeof(FileStoreIndexHeader) + index_header().num_slots * sizeof(Slot);
+    if (!index_is_valid) {
+        rebuild_index();
+    }
+}
+
+bool FileStore::put(std::vector<uint8_t> const& key, std::vector<uint8_t> const& value)
+{
+    return put(std::string(key.begin(), key.end()), value);
+}
+
+bool FileStore::put(std::string const& key, std::vector<uint8_t> const& value)
+{
+    ASSERT(value.size() < FileStoreHeader::DELETED);
+    pending_[key] = std::string(value.begin(), value.end());
+    return true;
+}
+
+bool FileStore::del(std::vector<uint8_t> const& key)
+{
+    pending_[std::string(key.begin(), key.end())] = std::nullopt;
+    return true;
+}
+
+bool FileStore::get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value)
+{
+    return get(std::string(key.begin(), key.end()), value);
+}
+
+bool FileStore::get(std::string const& key, std::vector<uint8_t>& value)
+{
+    auto pending = pending_.find(key);
+    if (pending != pending_.end()) {
+        if (!pending->second.has_value()) {
+            return false;
+        }
+        value.assign(pending->second->begin(), pending->second->end());
+        return true;
+    }
+
+    auto cached = cache_.find(key);
+    if (cached != cache_.end()) {
+        cache_entries_.splice(cache_entries_.begin(), cache_entries_, cached->second);
+        value = cached->second->second;
+        return true;
+    }
+
+    const auto committed = get_committed(key);
+    if (!committed.has_value()) {
+        return false;
+    }
+    value.assign(committed->begin(), committed->end());
+    cache_insert(key, *committed);
+    return true;
+}
+
+std::optional<std::span<const uint8_t>> FileStore::get_view(std::string_view key)
+{
+    auto pending = pending_.find(std::string(key));
+    if (pending != pending_.end()) {
+        if (!pending->second.has_value()) {
+            return std::nullopt;
+        }
+        return std::span(reinterpret_cast<uint8_t const*>(pending->second->data()), pending->second->size());
+    }
+    return get_committed(key);
+}
+
+void FileStore::commit()
+{
+    if (pending_.empty()) {
+        return;
+    }
+    size_t batch_size = 0;
+    for (const auto& [key, value] : pending_) {
+        batch_size += RECORD_HEADER_SIZE + key.size() + (value.has_value() ? value->size() : 0);
+    }
+    const size_t begin = sizeof(FileStoreHeader) + header().committed_size;
+    if (begin + batch_size > log_->size()) {
+        log_->resize(std::max(begin + batch_size, 2 * log_->size()));
+    }
+
+    // Append the records past the committed ones, where they are ignored until the header is updated
+    std::vector<uint64_t> offsets;
+    offsets.reserve(pending_.size());
+    size_t offset = begin;
+    for (const auto& [key, value] : pending_) {
+        const auto key_size = static_cast<uint32_t>(key.size());
+        const auto value_size = value.has_value() ? static_cast<uint32_t>(value->size()) : FileStoreHeader::DELETED;
+        std::memcpy(log_->data() + offset, &key_size, sizeof(uint32_t));
+        std::memcpy(log_->data() + offset + sizeof(uint32_t), &value_size, sizeof(uint32_t));
+        std::memcpy(log_->data() + offset + RECORD_HEADER_SIZE, key.data(), key.size());
+        if (value.has_value()) {
+            std::memcpy(log_->data() + offset + RECORD_HEADER_SIZE + key.size(), value->data(), value->size());
+        }
+        offsets.push_back(offset);
+        offset += get_record_size(key_size, value_size);
+    }
+    log_->sync(begin, batch_size);
+
+    // An index that is interrupted while being updated is rebuilt on the next open
+    index_header().committed_size = FileStoreIndexHeader::UPDATING;
+    index_->sync(0, sizeof(FileStoreIndexHeader));
+    for (const uint64_t record_offset : offsets) {
+        index_record(record_offset);
+    }
+    index_header().committed_size = header().committed_size + batch_size;
+
+    // The batch is committed once the header is synced
+    header().committed_size += batch_size;
+    log_->sync(0, sizeof(FileStoreHeader));
+
+    for (const auto& [key, value] : pending_) {
+        auto cached = cache_.find(key);
+        if (cached != cache_.end()) {
+            cache_entries_.erase(cached->second);
+            cache_.erase(cached);
+        }
+    }
+    pending_.clear();
+}
+
+FileStoreHeader& FileStore::header()
+{
+    return *reinterpret_cast<FileStoreHeader*>(log_->data());
+}
+
+FileStoreIndexHeader& FileStore::index_header()
+{
+    return *reinterpret_cast<FileStoreIndexHeader*>(index_->data());
+}
+
+FileStore::Slot* FileStore::slots()
+{
+    return reinterpret_cast<Slot*>(index_->data() + sizeof(FileStoreIndexHeader));
+}
+
+std::string_view FileStore::record_key(const uint64_t offset) const
+{
+    const auto [key_size, value_size] = read_record_header(log_->data() + offset);
+    return { reinterpret_cast<char const*>(log_->data() + offset + RECORD_HEADER_SIZE), key_size };
+}
+
+std::optional<std::span<const uint8_t>> FileStore::get_committed(std::string_view key)
+{
+    const Slot& slot = find_slot(key, hash_key(key));
+    if (slot.offset == 0) {
+        return std::nullopt;
+    }
+    const auto [key_size, value_size] = read_record_header(log_->data() + slot.offset);
+    if (value_size == FileStoreHeader::DELETED) {
+        return std::nullopt;
+    }
+    return std::span<const uint8_t>(log_->data() + slot.offset + RECORD_HEADER_SIZE + key_size, value_size);
+}
+
+FileStore::Slot& FileStore::find_slot(std::string_view key, const uint64_t hash)
+{
+    // linear probing, the table is at most half full
+    const uint64_t mask = index_header().num_slots - 1;
+    Slot* table = slots();
+    for (uint64_t i = hash & mask;; i = (i + 1) & mask) {
+        if (table[i].offset == 0 || (table[i].hash == hash && record_key(table[i].offset) == key)) {
+            return table[i];
+        }
+    }
+}
+
+void FileStore::index_record(const uint64_t offset)
+{
+    const std::string_view key = record_key(offset);
+    const uint64_t hash = hash_key(key);
+    Slot* slot = &find_slot(key, hash);
+    if (slot->offset == 0) {
+        if (2 * (index_header().num_keys + 1) > index_header().num_slots) {
+            resize_index(2 * index_header().num_slots);
+            slot = &find_slot(key, hash);
+        }
+        slot->hash = hash;
+        index_header().num_keys++;
+    }
+    slot->offset = offset;
+}
+
+void FileStore::resize_index(const uint64_t num_slots)
+{
+    const uint64_t old_num_slots = index_header().num_slots;
+    std::vector<Slot> old_slots(slots(), slots() + old_num_slots);
+
+    index_->resize(sizeof(FileStoreIndexHeader) + num_slots * sizeof(Slot));
+    std::memset(slots(), 0, num_slots * sizeof(Slot));
+    index_header().num_slots = num_slots;
+
+    // keys are distinct, so a slot is found from its hash alone
+    const uint64_t mask = num_slots - 1;
+    Slot* table = slots();
+    for (const Slot& slot : old_slots) {
+        if (slot.offset == 0) {
+            continue;
+        }
+        uint64_t i = slot.hash & mask;
+        while (table[i].offset != 0) {
+            i = (i + 1) & mask;
+        }
+        table[i] = slot;
+    }
+}
+
+void FileStore::rebuild_index()
+{
+    index_->resize(0);
+    index_->resize(sizeof(FileStoreIndexHeader) + INITIAL_NUM_SLOTS * sizeof(Slot));
+    index_header() = {
+        FileStoreIndexHeader::MAGIC, FileStoreIndexHeader::VERSION, FileStoreIndexHeader::UPDATING, INITIAL_NUM_SLOTS, 0
+    };
+
+    const uint64_t end = sizeof(FileStoreHeader) + header().committed_size;
+    for (uint64_t offset = sizeof(FileStoreHeader); offset < end;) {
+        index_record(offset);
+        const auto [key_size, value_size] = read_record_header(log_->data() + offset);
+        offset += get_record_size(key_size, value_size);
+    }
+    index_header().committed_size = header().committed_size;
+}
+
+void FileStore::cache_insert(std::string const& key, std::span<const uint8_t> value)
+{
+    if (cache_size_ == 0) {
+        return;
+    }
+    if (cache_.size() >= cache_size_) {
+        cache_.erase(cache_entries_.back().first);
+        cache_entries_.pop_back();
+    }
+    cache_entries_.emplace_front(key, std::vector<uint8_t>(value.begin(), value.end()));
+    cache_[key] = cache_entries_.begin();
+}
+
+} // namespace bb::stdlib::merkle_tree
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
@@ -0,0 +1,132 @@
+#pragma once
+#include "barretenberg/common/mapped_file.hpp"
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace bb::stdlib::merkle_tree {
+
+/**
+ * @brief Header of the log file of a FileStore.
+ *
+ * @details The header is followed by the records of the store, each made of the key size and the value size as 4 byte
+ * integers, then the key and the value. A record with a value size of `DELETED` marks the deletion of its key. Only the
+ * first `committed_size` bytes of records are valid: anything after them was written by an interrupted commit.
+ */
+struct FileStoreHeader {
+    static constexpr uint64_t MAGIC = 0x45524f5453454c46; // "FLESTORE"
+    static constexpr uint64_t VERSION = 1;
+    static constexpr uint32_t DELETED = 0xffffffff;
+
+    uint64_t magic;
+    uint64_t version;
+    uint64_t committed_size;
+};
+
+/**
+ * @brief Header of the index file of a FileStore.
+ *
+ * @details The header is followed by `num_slots` slots of an open addressing hash table, which maps each key to the
+ * offset of its latest record in the log. The index can always be rebuilt from the log, which is done when it is
+ * missing or was not built for the committed size of the log.
+ */
+struct FileStoreIndexHeader {
+    static constexpr uint64_t MAGIC = 0x58444e4953454c46; // "FLESINDX"
+    static constexpr uint64_t VERSION = 1;
+    // committed_size of an index that is being updated
+    static constexpr uint64_t UPDATING = ~0ULL;
+
+    uint64_t magic;
+    uint64_t version;
+    uint64_t committed_size;
+    uint64_t num_slots;
+    uint64_t num_keys;
+};
+
+/**
+ * @brief A persistent store for MerkleTree, kept in a log file and an index file that are memory mapped.
+ *
+ * @details Puts and deletes are buffered until `commit`, which appends them to the log and syncs it once for the whole
+ * batch, or `rollback`. Records are never rewritten, so a commit that is interrupted leaves the committed state intact.
+ *
+ * Nothing but the pending changes and a bounded LRU cache of recently read values is held in memory: the log and its
+ * index are read through their mappings, whose pages the kernel loads and evicts as needed. `get_view` returns values
+ * without copying them.
+ *
+ * Like MemoryStore, a FileStore is not thread safe.
+ */
+class FileStore {
+  public:
+    static constexpr size_t DEFAULT_CACHE_SIZE = 1UL << 16;
+
+    /**
+     * @param path The log file, created if it does not exist. The index is kept at `path` + ".index".
+     * @param cache_size Number of values kept in the LRU cache
+     */
+    explicit FileStore(std::string const& path, size_t cache_size = DEFAULT_CACHE_SIZE);
+    FileStore(FileStore const& rhs) = delete;
+    FileStore(FileStore&& rhs) = delete;
+    FileStore& operator=(FileStore const& rhs) = delete;
+    FileStore& operator=(FileStore&& rhs) = delete;
+    ~FileStore() = default;
+
+    bool put(std::vector<uint8_t> const& key, std::vector<uint8_t> const& value);
+
+    bool put(std::string const& key, std::vector<uint8_t> const& value);
+
+    bool del(std::vector<uint8_t> const& key);
+
+    bool get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value);
+
+    bool get(std::string const& key, std::vector<uint8_t>& value);
+
+    /**
+     * @brief Returns the value of `key` without copying it, or nullopt if there is none.
+     *
+     * @details The view is invalidated by the next put, del, commit or rollback.
+     */
+    std::optional<std::span<const uint8_t>> get_view(std::string_view key);
+
+    void commit();
+
+    void rollback() { pending_.clear(); }
+
+  private:
+    struct Slot {
+        uint64_t hash;
+        // offset of the latest record of the key in the log, or 0 for an empty slot
+        uint64_t offset;
+    };
+
+    using CacheEntries = std::list<std::pair<std::string, std::vector<uint8_t>>>;
+
+    FileStoreHeader& header();
+    FileStoreIndexHeader& index_header();
+    Slot* slots();
+
+    std::string_view record_key(uint64_t offset) const;
+    std::optional<std::span<const uint8_t>> get_committed(std::string_view key);
+    Slot& find_slot(std::string_view key, uint64_t hash);
+    void index_record(uint64_t offset);
+    void resize_index(uint64_t num_slots);
+    void rebuild_index();
+    void cache_insert(std::string const& key, std::span<const uint8_t> value);
+
+    std::unique_ptr<MappedFile> log_;
+    std::unique_ptr<MappedFile> index_;
+    // nullopt for a pending deletion
+    std::map<std::string, std::optional<std::string>> pending_;
+
+    size_t cache_size_;
+    CacheEntries cache_entries_;
+    std::unordered_map<std::string, CacheEntries::iterator> cache_;
+};
+
+} // namespace bb::stdlib::merkle_tree
@@ -0,0 +1,133 @@
+#include "file_store.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "memory_store.hpp"
+#include "merkle_tree.hpp"
+#include <filesystem>
+#include <gtest/gtest.h>
+
+using namespace bb;
+using namespace bb::stdlib::merkle_tree;
+
+namespace {
+auto& engine = numeric::random::get_debug_engine();
+
+class FileStoreTests : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        path = (std::filesystem::temp_directory_path() /
+                ::testing::UnitTest::GetInstance()->current_test_info()->name())
+                   .string();
+        remove_files();
+    }
+
+    void TearDown() override { remove_files(); }
+
+    void remove_files() const
+    {
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + ".index");
+    }
+
+    std::string path;
+};
+
+std::vector<uint8_t> to_bytes(std::string const& str)
+{
+    return { str.begin(), str.end() };
+}
+} // namespace
+
+TEST_F(FileStoreTests, PutGetDelete)
+{
+    FileStore store(path);
+    std::vector<uint8_t> value;
+    EXPECT_FALSE(store.get(to_bytes("a"), value));
+
+    store.put(to_bytes("a"), to_bytes("1"));
+    store.put(to_bytes("b"), to_bytes("2"));
+    EXPECT_TRUE(store.get(to_bytes("a"), value));
+    EXPECT_EQ(value, to_bytes("1"));
+    store.commit();
+    EXPECT_TRUE(store.get(to_bytes("a"), value));
+    EXPECT_EQ(value, to_bytes("1"));
+
+    // overwrites and deletions are visible before and after they are committed
+    store.put(to_bytes("a"), to_bytes("3"));
+    store.del(to_bytes("b"));
+    EXPECT_TRUE(store.get(to_bytes("a"), value));
+    EXPECT_EQ(value, to_bytes("3"));
+    EXPECT_FALSE(store.get(to_bytes("b"), value));
+    store.commit();
+    EXPECT_TRUE(store.get(to_bytes("a"), value));
+    EXPECT_EQ(value, to_bytes("3"));
+    EXPECT_FALSE(store.get(to_bytes("b"), value));
+
+    const auto view = store.get_view("a");
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(std::vector<uint8_t>(view->begin(), view->end()), to_bytes("3"));
+    EXPECT_FALSE(store.get_view("b").has_value());
+
+    store.put(to_bytes("c"), to_bytes("4"));
+    store.rollback();
+    EXPECT_FALSE(store.get(to_bytes("c"), value));
+}
+
+TEST_F(FileStoreTests, Persistence)
+{
+    {
+        FileStore store(path);
+        store.put(to_bytes("a"), to_bytes("1"));
+        store.commit();
+        store.put(to_bytes("b"), to_bytes("2"));
+    }
+    std::vector<uint8_t> value;
+    {
+        // uncommitted changes are lost
+        FileStore store(path);
+        EXPECT_TRUE(store.get(to_bytes("a"), value));
+        EXPECT_EQ(value, to_bytes("1"));
+        EXPECT_FALSE(store.get(to_bytes("b"), value));
+    }
+
+    // the index is rebuilt from the log
+    std::filesystem::remove(path + ".index");
+    FileStore store(path);
+    EXPECT_TRUE(store.get(to_bytes("a"), value));
+    EXPECT_EQ(value, to_bytes("1"));
+}
+
+TEST_F(FileStoreTests, MerkleTreeConsistency)
+{
+    constexpr size_t depth = 32;
+    constexpr size_t num_updates = 256;
+    MemoryStore memory_store;
+    MerkleTree<MemoryStore> expected(memory_store, depth);
+    std::vector<std::pair<MerkleTree<MemoryStore>::index_t, fr>> updates;
+    for (size_t i = 0; i < num_updates; ++i) {
+        updates.emplace_back(engine.get_random_uint32(), fr::random_element(&engine));
+        expected.update_element(updates.back().first, updates.back().second);
+    }
+
+    {
+        // a small cache, so that values are read from the file
+        FileStore store(path, 16);
+        MerkleTree<FileStore> tree(store, depth);
+        for (size_t i = 0; i < num_updates; ++i) {
+            tree.update_element(updates[i].first, updates[i].second);
+            // commit in batches, and grow the log and the index
+            if (i % 64 == 63) {
+                store.commit();
+            }
+        }
+        EXPECT_EQ(tree.root(), expected.root());
+        EXPECT_EQ(tree.size(), expected.size());
+    }
+
+    FileStore store(path, 16);
+    MerkleTree<FileStore> tree(store, depth);
+    EXPECT_EQ(tree.root(), expected.root());
+    for (size_t i = 0; i < num_updates; i += 16) {
+        EXPECT_EQ(tree.get_hash_path(updates[i].first), expected.get_hash_path(updates[i].first));
+    }
+}
@@ -6,6 +6,8 @@
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <array>
+#include <span>
 #include <vector>
 
 namespace bb::stdlib::merkle_tree {
@@ -20,6 +22,22 @@ inline bb::fr hash_native(std::vector<bb::fr> const& inputs)
     return crypto::pedersen_hash::hash(inputs); // uses lookup tables
 }
 
+/**
+ * Hashes the pairs of adjacent elements of `layer`, giving the next layer of a tree.
+ *
+ * @param layer: vector of an even number of nodes.
+ * @returns vector of the parents of the nodes
+ */
+inline std::vector<bb::fr> compute_next_layer_native(std::span<const bb::fr> layer)
+{
+    ASSERT(layer.size() % 2 == 0);
+    // two adjacent nodes have the layout of an std::array<fr, 2>, so the pairs are hashed in place
+    static_assert(sizeof(std::array<bb::fr, 2>) == 2 * sizeof(bb::fr));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const std::span pairs(reinterpret_cast<std::array<bb::fr, 2> const*>(layer.data()), layer.size() / 2);
+    return crypto::pedersen_hash::hash_batch(pairs);
+}
+
 /**
  * Computes the root of a tree with leaves given as the vector `input`.
  *
@@ -33,11 +51,7 @@ inline bb::fr compute_tree_root_native(std::vector<bb::fr> const& input)
     ASSERT(numeric::is_power_of_two(input.size()));
     auto layer = input;
     while (layer.size() > 1) {
-        std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-        }
-        layer = std::move(next_layer);
+        layer = compute_next_layer_native(layer);
     }
 
     return layer[0];
@@ -52,12 +66,8 @@ inline std::vector<bb::fr> compute_tree_native(std::vector<bb::fr> const& input)
     auto layer = input;
     std::vector<bb::fr> tree(input);
     while (layer.size() > 1) {
-        std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-            tree.push_back(next_layer[i]);
-        }
-        layer = std::move(next_layer);
+        layer = compute_next_layer_native(layer);
+        tree.insert(tree.end(), layer.begin(), layer.end());
     }
 
     return tree;
@@ -1,5 +1,6 @@
 #include "memory_tree.hpp"
 #include "hash.hpp"
+#include <algorithm>
 
 namespace bb::stdlib::merkle_tree {
 
@@ -59,6 +60,8 @@ fr_sibling_path MemoryTree::get_sibling_path(size_t index)
 
 fr MemoryTree::update_element(size_t index, fr const& value)
 {
+    ASSERT(index < total_size_);
+    next_index_ = std::max(next_index_, index + 1);
     size_t offset = 0;
     size_t layer_size = total_size_;
     fr current = value;
@@ -74,4 +77,77 @@ fr MemoryTree::update_element(size_t index, fr const& value)
     return root_;
 }
 
-} // namespace bb::stdlib::merkle_tree
\ No newline at end of file
+fr MemoryTree::update_elements(std::vector<size_t> const& indices, std::vector<fr> const& values)
+{
+    ASSERT(indices.size() == values.size());
+    if (indices.empty()) {
+        return root_;
+    }
+    // indices of the nodes of the current layer that must be rehashed, i.e. the parents of the updated nodes
+    std::vector<size_t> dirty(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        ASSERT(indices[i] < total_size_);
+        hashes_[indices[i]] = values[i];
+        next_index_ = std::max(next_index_, indices[i] + 1);
+        dirty[i] = indices[i] >> 1;
+    }
+    std::sort(dirty.begin(), dirty.end());
+    dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+
+    size_t offset = 0;
+    size_t layer_size = total_size_;
+    std::vector<std::array<fr, 2>> children;
+    for (size_t i = 0; i < depth_; ++i) {
+        children.resize(dirty.size());
+        for (size_t j = 0; j < dirty.size(); ++j) {
+            children[j] = { hashes_[offset + 2 * dirty[j]], hashes_[offset + 2 * dirty[j] + 1] };
+        }
+        const auto parents = crypto::pedersen_hash::hash_batch(children);
+        offset += layer_size;
+        layer_size >>= 1;
+        // the root is not stored in hashes_
+        if (i == depth_ - 1) {
+            root_ = parents[0];
+            break;
+        }
+        for (size_t j = 0; j < dirty.size(); ++j) {
+            hashes_[offset + dirty[j]] = parents[j];
+            dirty[j] >>= 1;
+        }
+        // parents of sorted nodes are sorted, only neighbours can share one
+        dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+    }
+    return root_;
+}
+
+fr MemoryTree::append_subtree(std::vector<fr> const& leaves)
+{
+    ASSERT(next_index_ + leaves.size() <= total_size_);
+    if (leaves.empty()) {
+        return root_;
+    }
+    // the updated nodes of the current layer are [begin, end)
+    size_t begin = next_index_;
+    size_t end = next_index_ + leaves.size();
+    std::copy(leaves.begin(), leaves.end(), hashes_.begin() + static_cast<std::ptrdiff_t>(begin));
+    next_index_ = end;
+
+    size_t offset = 0;
+    size_t layer_size = total_size_;
+    for (size_t i = 0; i < depth_; ++i) {
+        begin >>= 1;
+        end = (end + 1) >> 1;
+        const auto parents =
+            compute_next_layer_native(std::span<const fr>(&hashes_[offset + 2 * begin], 2 * (end - begin)));
+        offset += layer_size;
+        layer_size >>= 1;
+        if (i == depth_ - 1) {
+            root_ = parents[0];
+            break;
+        }
+        std::copy(parents.begin(), parents.end(), hashes_.begin() + static_cast<std::ptrdiff_t>(offset + begin));
+    }
+    return root_;
+}
+
+} // namespace bb::stdlib::merkle_tree
@@ -21,6 +21,10 @@ using namespace bb;
  * Here, depth_ = 3 and {h_{0,j}}_{i=0..7} are leaf values.
  * Also, root_ = h_{3,0} and total_size_ = (2 * 8 - 2) = 14.
  * Lastly, h_{i,j} = hash( h_{i-1,2j}, h_{i-1,2j+1} ) where i > 1.
+ *
+ * Batch updates rehash the tree one layer at a time: all the nodes of a layer that depend on an updated leaf are
+ * hashed together with `pedersen_hash::hash_batch`, which spreads them across threads, and each node is hashed once
+ * however many of its leaves changed.
  */
 class MemoryTree {
   public:
@@ -32,11 +36,29 @@ class MemoryTree {
 
     fr update_element(size_t index, fr const& value);
 
+    /**
+     * Sets the leaves at `indices` to `values` and returns the new root. Later entries win over earlier ones with the
+     * same index, as if update_element was called for each of them in order.
+     */
+    fr update_elements(std::vector<size_t> const& indices, std::vector<fr> const& values);
+
+    /**
+     * Writes `leaves` after the highest leaf written so far and returns the new root. The leaves are contiguous, so the
+     * nodes above them are contiguous in each layer and are hashed in place.
+     */
+    fr append_subtree(std::vector<fr> const& leaves);
+
+    /**
+     * One past the index of the highest leaf written so far.
+     */
+    size_t next_index() const { return next_index_; }
+
     fr root() const { return root_; }
 
   public:
     size_t depth_;
     size_t total_size_;
+    size_t next_index_ = 0;
     bb::fr root_;
     std::vector<bb::fr> hashes_;
 };
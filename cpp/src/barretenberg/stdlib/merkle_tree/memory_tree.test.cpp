@@ -78,3 +78,43 @@ TEST(stdlib_merkle_tree, test_memory_store_sibling_path)
     EXPECT_EQ(db.get_sibling_path(3), expected03);
     EXPECT_EQ(db.root(), root);
 }
+
+TEST(stdlib_merkle_tree, test_memory_store_update_elements)
+{
+    constexpr size_t depth = 6;
+    MemoryTree expected(depth);
+    MemoryTree db(depth);
+
+    // includes a repeated index, whose last value must win
+    std::vector<size_t> indices{ 5, 63, 0, 6, 5, 32 };
+    std::vector<fr> values;
+    for (size_t i = 0; i < indices.size(); ++i) {
+        values.emplace_back(fr::random_element());
+        expected.update_element(indices[i], values[i]);
+    }
+
+    EXPECT_EQ(db.update_elements(indices, values), expected.root());
+    EXPECT_EQ(db.hashes_, expected.hashes_);
+    EXPECT_EQ(db.next_index(), 64);
+    EXPECT_EQ(db.update_elements({}, {}), expected.root());
+}
+
+TEST(stdlib_merkle_tree, test_memory_store_append_subtree)
+{
+    constexpr size_t depth = 5;
+    MemoryTree expected(depth);
+    MemoryTree db(depth);
+
+    // appends that are not aligned to a subtree, then fill the tree
+    size_t index = 0;
+    for (const size_t num_leaves : { 3, 1, 6, 16, 6 }) {
+        std::vector<fr> leaves(num_leaves);
+        for (auto& leaf : leaves) {
+            leaf = fr::random_element();
+            expected.update_element(index++, leaf);
+        }
+        EXPECT_EQ(db.append_subtree(leaves), expected.root());
+        EXPECT_EQ(db.hashes_, expected.hashes_);
+        EXPECT_EQ(db.next_index(), index);
+    }
+}
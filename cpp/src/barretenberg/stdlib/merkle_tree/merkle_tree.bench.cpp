@@ -1,8 +1,11 @@
 #include "merkle_tree.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
+#include "file_store.hpp"
 #include "hash.hpp"
 #include "memory_store.hpp"
+#include "memory_tree.hpp"
 #include <benchmark/benchmark.h>
+#include <filesystem>
 
 using namespace benchmark;
 using namespace bb::stdlib::merkle_tree;
@@ -71,4 +74,77 @@ void update_random_elements(State& state) noexcept
 }
 BENCHMARK(update_random_elements)->Unit(benchmark::kMillisecond)->Range(100, 100)->Iterations(1);
 
+constexpr size_t MEMORY_TREE_DEPTH = 20;
+
+std::vector<size_t> random_indices(size_t num_indices)
+{
+    std::vector<size_t> indices(num_indices);
+    for (auto& index : indices) {
+        index = engine.get_random_uint64() & ((1UL << MEMORY_TREE_DEPTH) - 1);
+    }
+    return indices;
+}
+
+void memory_tree_update_elements_one_by_one(State& state) noexcept
+{
+    MemoryTree db(MEMORY_TREE_DEPTH);
+    const auto indices = random_indices(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (size_t i = 0; i < indices.size(); ++i) {
+            db.update_element(indices[i], VALUES[i]);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(memory_tree_update_elements_one_by_one)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(256, MAX);
+
+void memory_tree_update_elements(State& state) noexcept
+{
+    MemoryTree db(MEMORY_TREE_DEPTH);
+    const auto indices = random_indices(static_cast<size_t>(state.range(0)));
+    const std::vector<fr> values(VALUES.begin(), VALUES.begin() + state.range(0));
+    for (auto _ : state) {
+        db.update_elements(indices, values);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(memory_tree_update_elements)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(256, MAX);
+
+void memory_tree_append_subtree(State& state) noexcept
+{
+    const std::vector<fr> values(VALUES.begin(), VALUES.begin() + state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        MemoryTree db(MEMORY_TREE_DEPTH);
+        state.ResumeTiming();
+        db.append_subtree(values);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(memory_tree_append_subtree)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(256, MAX);
+
+void file_store_update_random_elements(State& state) noexcept
+{
+    const auto path = (std::filesystem::temp_directory_path() / "merkle_tree_bench_file_store").string();
+    std::filesystem::remove(path);
+    std::filesystem::remove(path + ".index");
+    {
+        FileStore store(path);
+        MerkleTree<FileStore> db(store, DEPTH);
+        for (auto _ : state) {
+            for (size_t i = 0; i < (size_t)state.range(0); i++) {
+                state.PauseTiming();
+                auto index = MerkleTree<FileStore>::index_t(engine.get_random_uint256());
+                state.ResumeTiming();
+                db.update_element(index, VALUES[i]);
+            }
+            store.commit();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+    std::filesystem::remove(path);
+    std::filesystem::remove(path + ".index");
+}
+BENCHMARK(file_store_update_random_elements)->Unit(benchmark::kMillisecond)->Range(100, 100)->Iterations(10);
+
 BENCHMARK_MAIN();
@@ -3,6 +3,7 @@
 #include "barretenberg/numeric/bitop/count_leading_zeros.hpp"
 #include "barretenberg/numeric/bitop/keep_n_lsb.hpp"
 #include "barretenberg/numeric/uint128/uint128.hpp"
+#include "file_store.hpp"
 #include "hash.hpp"
 #include "memory_store.hpp"
 #include <iostream>
@@ -350,5 +351,6 @@ template <typename Store> void MerkleTree<Store>::remove(fr const& key)
 }
 
 template class MerkleTree<MemoryStore>;
+template class MerkleTree<FileStore>;
 
 } // namespace bb::stdlib::merkle_tree
@@ -4,6 +4,32 @@
 
 namespace bb::honk {
 
+/**
+ * @brief Evaluate the Lagrange basis {L_0, ..., L_{NUM-1}} of the instance domain {0, ..., NUM - 1} and the vanishing
+ * polynomial Z(X) = Π_i (X - i) of the domain at a point, which is used to fold NUM instances with a challenge.
+ * @details Uses L_i(X) = Z(X) / ((X - i) * Π_{j ≠ i} (i - j)), so the point must lie outside of the domain.
+ */
+template <size_t NUM, typename FF>
+std::pair<std::array<FF, NUM>, FF> compute_lagrange_basis_and_vanishing_polynomial(const FF& point)
+{
+    FF vanishing_polynomial = 1;
+    std::array<FF, NUM> lagranges;
+    for (size_t i = 0; i < NUM; i++) {
+        vanishing_polynomial *= point - FF(i);
+        lagranges[i] = point - FF(i);
+        for (size_t j = 0; j < NUM; j++) {
+            if (j != i) {
+                lagranges[i] *= FF(i) - FF(j);
+            }
+        }
+    }
+    FF::batch_invert(lagranges);
+    for (auto& lagrange : lagranges) {
+        lagrange *= vanishing_polynomial;
+    }
+    return { lagranges, vanishing_polynomial };
+}
+
 template <typename Flavor_, size_t NUM_> struct ProverInstances_ {
   public:
     static_assert(NUM_ > 0, "Must have at least one prover instance");
@@ -36,11 +62,14 @@ template <typename Flavor_, size_t NUM_> struct ProverInstances_ {
         }
     };
 
+    // For each prover polynomial, a pointer to its coefficients in every instance
+    using PolynomialColumns = std::vector<std::array<const FF*, NUM>>;
+
     /**
-     * @brief For a fixed row index and each polynomial, construct univariates from the corresponding value
-     * from each instance.
+     * @brief For each prover polynomial, collect a pointer to the coefficients of that polynomial in every instance, so
+     * that the univariates of a row can be read straight out of the instances.
      *
-     * @example if the row index is 2, and there are 4 instances visually we have
+     * @example with 4 instances, visually we have
      *
      *           Instance 0       Instance 1       Instance 2       Instance 3
      *           q_c q_l q_r ...  q_c q_l q_r ...  q_c q_l q_r ...  q_c q_l q_r ...
@@ -49,40 +78,21 @@ template <typename Flavor_, size_t NUM_> struct ProverInstances_ {
      *           a_1 a_2 a_3 ...  b_1 b_2 b_3 ...  c_1 c_2 c_3 ...  d_1 d_2 d_3 ...
      *           *   *            *   *            *   *            *   *
      *
-     * and the function returns the univariates [{a_1, b_1, c_1, d_1}, {a_2, b_2, c_2, d_2}, ...]
+     * and the function returns the columns [{q_c^0, q_c^1, q_c^2, q_c^3}, {q_l^0, q_l^1, q_l^2, q_l^3}, ...]. Reading
+     * row 2 out of the columns gives the univariates [{a_1, b_1, c_1, d_1}, {a_2, b_2, c_2, d_2}, ...].
      *
-     * @param row_idx A fixed row position in several execution traces
-     * @return The univariates whose extensions will be used to construct the combiner.
+     * @details The polynomial views of the instances are heap allocated, so they are gathered once here rather than
+     * for every row of the combiner computation.
      */
-    std::vector<Univariate<FF, NUM>> row_to_univariates(size_t row_idx) const
+    PolynomialColumns get_polynomial_columns() const
     {
-        auto insts_prover_polynomials_views = get_polynomials_views();
-        std::vector<Univariate<FF, NUM>> results;
-        // Set the size corresponding to the number of rows in the execution trace
-        results.resize(insts_prover_polynomials_views[0].size());
-        size_t instance_idx = 0;
-        // Iterate over the prover polynomials' views corresponding to each instance
-        for (auto& get_all : insts_prover_polynomials_views) {
-            // Iterate over all columns in the trace execution of an instance and extract their value at row_idx.
-            for (auto [result, poly_ptr] : zip_view(results, get_all)) {
-                result.evaluations[instance_idx] = poly_ptr[row_idx];
+        PolynomialColumns columns(_data[0]->prover_polynomials.get_all().size());
+        for (size_t instance_idx = 0; instance_idx < NUM; instance_idx++) {
+            for (auto [column, polynomial] : zip_view(columns, _data[instance_idx]->prover_polynomials.get_all())) {
+                column[instance_idx] = &polynomial[0];
             }
-            instance_idx++;
-        }
-        return results;
-    }
-
-  private:
-    // Returns a vector containing pointer views to the prover polynomials corresponding to each instance.
-    auto get_polynomials_views() const
-    {
-        // As a practical measure, get the first instance's view to deduce the vector type
-        std::vector get_alls{ _data[0]->prover_polynomials.get_all() };
-        // complete the views, starting from the second item
-        for (size_t i = 1; i < NUM; i++) {
-            get_alls.push_back(_data[i]->prover_polynomials.get_all());
         }
-        return get_alls;
+        return columns;
     }
 };
 
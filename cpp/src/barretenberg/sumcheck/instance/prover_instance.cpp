@@ -1,4 +1,6 @@
 #include "prover_instance.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/honk/proof_system/logderivative_library.hpp"
 #include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
 #include "barretenberg/proof_system/composer/permutation_lib.hpp"
@@ -280,6 +282,47 @@ std::shared_ptr<typename Flavor::ProvingKey> ProverInstance_<Flavor>::compute_pr
     return proving_key;
 }
 
+/**
+ * @brief Set up a proving key that shares the precomputed polynomials of an existing key and owns fresh witness
+ * polynomials
+ * @details The existing key is left untouched, so it can back any number of instances.
+ *
+ * @tparam Flavor
+ * @param precomputed_key
+ */
+template <class Flavor>
+void ProverInstance_<Flavor>::share_precomputed_polynomials(const std::shared_ptr<ProvingKey>& precomputed_key)
+{
+    if (precomputed_key->circuit_size != dyadic_circuit_size ||
+        precomputed_key->num_public_inputs != num_public_inputs) {
+        throw_or_abort("Precomputed proving key does not match the circuit.");
+    }
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        if (precomputed_key->num_ecc_op_gates != num_ecc_op_gates) {
+            throw_or_abort("Precomputed proving key does not match the circuit.");
+        }
+    }
+
+    proving_key = std::make_shared<ProvingKey>();
+    proving_key->circuit_size = precomputed_key->circuit_size;
+    proving_key->log_circuit_size = precomputed_key->log_circuit_size;
+    proving_key->num_public_inputs = precomputed_key->num_public_inputs;
+    proving_key->circuit_type = precomputed_key->circuit_type;
+    proving_key->evaluation_domain = bb::EvaluationDomain<FF>(dyadic_circuit_size, dyadic_circuit_size);
+    proving_key->contains_recursive_proof = precomputed_key->contains_recursive_proof;
+    proving_key->recursive_proof_public_input_indices = precomputed_key->recursive_proof_public_input_indices;
+    if constexpr (IsGoblinFlavor<Flavor>) {
+        proving_key->num_ecc_op_gates = precomputed_key->num_ecc_op_gates;
+    }
+    for (auto [poly, precomputed_poly] :
+         zip_view(proving_key->get_precomputed_polynomials(), precomputed_key->get_precomputed_polynomials())) {
+        poly = precomputed_poly.share();
+    }
+    for (auto& poly : proving_key->get_witness_polynomials()) {
+        poly = Polynomial(dyadic_circuit_size);
+    }
+}
+
 template <class Flavor> void ProverInstance_<Flavor>::initialize_prover_polynomials()
 {
     for (auto [prover_poly, key_poly] : zip_view(prover_polynomials.get_unshifted(), proving_key->get_all())) {
@@ -341,16 +384,18 @@ template <class Flavor> void ProverInstance_<Flavor>::compute_sorted_list_accumu
     auto sorted_list_accumulator = Polynomial{ circuit_size };
 
     // Construct s via Horner, i.e. s = s_1 + η(s_2 + η(s_3 + η*s_4))
-    for (size_t i = 0; i < circuit_size; ++i) {
-        FF T0 = sorted_polynomials[3][i];
-        T0 *= eta;
-        T0 += sorted_polynomials[2][i];
-        T0 *= eta;
-        T0 += sorted_polynomials[1][i];
-        T0 *= eta;
-        T0 += sorted_polynomials[0][i];
-        sorted_list_accumulator[i] = T0;
-    }
+    run_loop_in_parallel(circuit_size, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            FF T0 = sorted_polynomials[3][i];
+            T0 *= eta;
+            T0 += sorted_polynomials[2][i];
+            T0 *= eta;
+            T0 += sorted_polynomials[1][i];
+            T0 *= eta;
+            T0 += sorted_polynomials[0][i];
+            sorted_list_accumulator[i] = T0;
+        }
+    });
     proving_key->sorted_accum = sorted_list_accumulator.share();
 }
 
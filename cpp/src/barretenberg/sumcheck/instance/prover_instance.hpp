@@ -65,6 +65,18 @@ template <class Flavor> class ProverInstance_ {
         compute_witness(circuit);
     }
 
+    /**
+     * @brief Construct an instance whose precomputed polynomials are shared with an existing proving key, e.g. one read
+     * with read_mmap_proving_key, so that only the witness polynomials are computed from the circuit.
+     * @details The circuit must be finalized and must be the one the key was computed for, up to its witness values.
+     */
+    ProverInstance_(Circuit& circuit, const std::shared_ptr<ProvingKey>& precomputed_key)
+    {
+        compute_circuit_size_parameters(circuit);
+        share_precomputed_polynomials(precomputed_key);
+        compute_witness(circuit);
+    }
+
     ProverInstance_() = default;
     ~ProverInstance_() = default;
 
@@ -93,6 +105,8 @@ template <class Flavor> class ProverInstance_ {
 
     std::shared_ptr<ProvingKey> compute_proving_key(Circuit&);
 
+    void share_precomputed_polynomials(const std::shared_ptr<ProvingKey>&);
+
     void compute_circuit_size_parameters(Circuit&);
 
     void compute_witness(Circuit&);
@@ -7,6 +7,64 @@
 
 namespace bb::honk::sumcheck {
 
+/**
+ * @brief A read-only view of the polynomials partially evaluated at the challenges u_0, ..., u_{r-1} of the rounds
+ * computed so far, which reads each value straight out of the full polynomials instead of storing it.
+ * @details The value at index i is Σ_b eq(u, b) * P[i * 2^r + b] over b ∈ {0, 1}^r, where bit j of b corresponds to
+ * the challenge u_j. Reading a value costs 2^r multiplications, so the view is only worth it for the first few rounds.
+ */
+template <typename FF> class StreamedMultivariates {
+  public:
+    class StreamedPolynomial {
+      public:
+        StreamedPolynomial(const FF* coefficients, const std::vector<FF>& weights)
+            : coefficients(coefficients)
+            , weights(&weights){};
+
+        FF operator[](size_t idx) const
+        {
+            const size_t num_weights = weights->size();
+            const FF* source = coefficients + idx * num_weights;
+            FF result = 0;
+            for (size_t b = 0; b < num_weights; b++) {
+                result += (*weights)[b] * source[b];
+            }
+            return result;
+        }
+
+      private:
+        const FF* coefficients;
+        const std::vector<FF>* weights;
+    };
+
+    StreamedMultivariates(auto& full_polynomials, const std::vector<FF>& challenges)
+    {
+        // Construct the table eq(u, b) for all b ∈ {0, 1}^r, doubling its size with each challenge
+        weights = { FF(1) };
+        weights.reserve(static_cast<size_t>(1) << challenges.size());
+        for (const FF& challenge : challenges) {
+            const size_t num_weights = weights.size();
+            weights.resize(num_weights << 1);
+            for (size_t b = 0; b < num_weights; b++) {
+                weights[b + num_weights] = weights[b] * challenge;
+                weights[b] -= weights[b + num_weights];
+            }
+        }
+        for (auto& polynomial : full_polynomials.get_all()) {
+            polynomials.emplace_back(&polynomial[0], weights);
+        }
+    }
+    // The polynomials keep a pointer to the weights
+    StreamedMultivariates(const StreamedMultivariates&) = delete;
+    StreamedMultivariates& operator=(const StreamedMultivariates&) = delete;
+
+    const std::vector<StreamedPolynomial>& get_all() const { return polynomials; }
+
+  private:
+    std::vector<FF> weights;
+    std::vector<StreamedPolynomial> polynomials;
+};
+
 template <typename Flavor> class SumcheckProver {
 
   public:
@@ -20,6 +78,9 @@ template <typename Flavor> class SumcheckProver {
 
     const size_t multivariate_n;
     const size_t multivariate_d;
+    // The number of rounds whose univariates are computed from the full polynomials, before the partially evaluated
+    // polynomials are materialised
+    const size_t num_streamed_rounds;
 
     std::shared_ptr<Transcript> transcript;
     SumcheckProverRound<Flavor> round;
@@ -57,13 +118,24 @@ template <typename Flavor> class SumcheckProver {
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
 
-    // prover instantiates sumcheck with circuit size and a prover transcript
-    SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
+    /**
+     * @brief Prover instantiates sumcheck with circuit size and a prover transcript.
+     *
+     * @param num_streamed_rounds In a low-memory mode, more than one round can be computed from the full polynomials
+     * using StreamedMultivariates. The partially evaluated polynomials are then only materialised after the last of
+     * these rounds, at size n / 2^{num_streamed_rounds}, at the cost of re-reading the full polynomials once per
+     * round.
+     */
+    SumcheckProver(size_t multivariate_n,
+                   const std::shared_ptr<Transcript>& transcript,
+                   size_t num_streamed_rounds = 1)
         : multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
+        , num_streamed_rounds(
+              std::clamp(num_streamed_rounds, static_cast<size_t>(1), std::max(multivariate_d, static_cast<size_t>(1))))
         , transcript(transcript)
         , round(multivariate_n)
-        , partially_evaluated_polynomials(multivariate_n){};
+        , partially_evaluated_polynomials(multivariate_n >> (this->num_streamed_rounds - 1)){};
 
     // WORKTODO delete this
     /**
@@ -95,17 +167,35 @@ template <typename Flavor> class SumcheckProver {
         multivariate_challenge.reserve(multivariate_d);
 
         // First round
-        // This populates partially_evaluated_polynomials.
         auto round_univariate = round.compute_univariate(full_polynomials, relation_parameters, pow_univariate, alpha);
         transcript->send_to_verifier("Sumcheck:univariate_0", round_univariate);
         FF round_challenge = transcript->get_challenge("Sumcheck:u_0");
         multivariate_challenge.emplace_back(round_challenge);
-        partially_evaluate(full_polynomials, multivariate_n, round_challenge);
         pow_univariate.partially_evaluate(round_challenge);
-        round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
-                                                  // release memory?        // All but final round
+        round.round_size = round.round_size >> 1;
+
+        // In the low-memory mode, compute the next few rounds from the full polynomials as well
+        for (size_t round_idx = 1; round_idx < num_streamed_rounds; round_idx++) {
+            StreamedMultivariates<FF> streamed_polynomials(full_polynomials, multivariate_challenge);
+            round_univariate =
+                round.compute_univariate(streamed_polynomials, relation_parameters, pow_univariate, alpha);
+            transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
+            FF round_challenge = transcript->get_challenge("Sumcheck:u_" + std::to_string(round_idx));
+            multivariate_challenge.emplace_back(round_challenge);
+            pow_univariate.partially_evaluate(round_challenge);
+            round.round_size = round.round_size >> 1;
+        }
+
+        // This populates partially_evaluated_polynomials.
+        if (num_streamed_rounds == 1) {
+            partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+        } else {
+            materialise_partial_evaluations(full_polynomials, multivariate_challenge);
+        }
+
+        // All but final round
         // We operate on partially_evaluated_polynomials in place.
-        for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
+        for (size_t round_idx = num_streamed_rounds; round_idx < multivariate_d; round_idx++) {
             // Write the round univariate to the transcript
             round_univariate =
                 round.compute_univariate(partially_evaluated_polynomials, relation_parameters, pow_univariate, alpha);
@@ -154,6 +244,22 @@ template <typename Flavor> class SumcheckProver {
             }
         });
     };
+    /**
+     * @brief Populate partially_evaluated_polynomials with the full polynomials partially evaluated at all the
+     * challenges of the streamed rounds at once.
+     */
+    void materialise_partial_evaluations(ProverPolynomials& full_polynomials, const std::vector<FF>& challenges)
+    {
+        StreamedMultivariates<FF> streamed_polynomials(full_polynomials, challenges);
+        auto pep_view = partially_evaluated_polynomials.get_all();
+        const auto& streamed_view = streamed_polynomials.get_all();
+        const size_t size = multivariate_n >> challenges.size();
+        parallel_for(pep_view.size(), [&](size_t j) {
+            for (size_t i = 0; i < size; i++) {
+                pep_view[j][i] = streamed_view[j][i];
+            }
+        });
+    };
     /**
      * @brief Evaluate at the round challenge and prepare class for next round.
      * Specialization for array, see generic version above.
@@ -256,4 +256,44 @@ TEST_F(SumcheckTests, ProverAndVerifierSimple)
     run_test(/* expect_verified=*/false);
 }
 
+// Computing the first rounds from the full polynomials in the low-memory mode should not change the proof
+TEST_F(SumcheckTests, ProverStreamedRounds)
+{
+    const size_t multivariate_d(4);
+    const size_t multivariate_n(1 << multivariate_d);
+
+    std::array<bb::Polynomial<FF>, NUM_POLYNOMIALS> random_polynomials;
+    for (auto& poly : random_polynomials) {
+        poly = random_poly(multivariate_n);
+    }
+    auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+
+    auto prove = [&](size_t num_streamed_rounds) {
+        auto transcript = Flavor::Transcript::prover_init_empty();
+        auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript, num_streamed_rounds);
+
+        RelationSeparator alpha;
+        for (size_t idx = 0; idx < alpha.size(); idx++) {
+            alpha[idx] = transcript->get_challenge("Sumcheck:alpha_" + std::to_string(idx));
+        }
+        std::vector<FF> gate_challenges(multivariate_d);
+        for (size_t idx = 0; idx < multivariate_d; idx++) {
+            gate_challenges[idx] = transcript->get_challenge("Sumcheck:gate_challenge_" + std::to_string(idx));
+        }
+        auto output = sumcheck.prove(full_polynomials, {}, alpha, gate_challenges);
+        return std::make_pair(output, transcript->proof_data);
+    };
+
+    auto [expected_output, expected_proof] = prove(1);
+    for (size_t num_streamed_rounds = 2; num_streamed_rounds <= multivariate_d; num_streamed_rounds++) {
+        auto [output, proof] = prove(num_streamed_rounds);
+        EXPECT_EQ(output.challenge, expected_output.challenge);
+        for (auto [eval, expected] :
+             zip_view(output.claimed_evaluations.get_all(), expected_output.claimed_evaluations.get_all())) {
+            EXPECT_EQ(eval, expected);
+        }
+        EXPECT_EQ(proof, expected_proof);
+    }
+}
+
 } // namespace test_sumcheck_round
@@ -7,6 +7,9 @@
 #include "barretenberg/relations/relation_types.hpp"
 #include "barretenberg/relations/utils.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace bb::honk::sumcheck {
 
 /*
@@ -59,6 +62,7 @@ template <typename Flavor> class SumcheckProverRound {
 
   public:
     using FF = typename Flavor::FF;
+    using Edges = typename Flavor::template ProverUnivariates<2>;
     using ExtendedEdges = typename Flavor::ExtendedEdges;
 
     size_t round_size; // a power of 2
@@ -78,23 +82,54 @@ template <typename Flavor> class SumcheckProverRound {
     }
 
     /**
-     * @brief Extend each edge in the edge group at to max-relation-length-many values.
+     * @brief Collect the values of each multivariate at the two ends of the edge starting at edge_idx.
      *
-     * @details Should only be called externally with relation_idx equal to 0.
-     * In practice, multivariates is one of ProverPolynomials or FoldedPolynomials.
+     * @details In practice, multivariates is one of ProverPolynomials or FoldedPolynomials.
      *
      */
     template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
-    void extend_edges(ExtendedEdges& extended_edges,
-                      const ProverPolynomialsOrPartiallyEvaluatedMultivariates& multivariates,
-                      size_t edge_idx)
+    void get_edges(Edges& edges,
+                   const ProverPolynomialsOrPartiallyEvaluatedMultivariates& multivariates,
+                   size_t edge_idx)
+    {
+        for (auto [edge, multivariate] : zip_view(edges.get_all(), multivariates.get_all())) {
+            edge = bb::Univariate<FF, 2>({ multivariate[edge_idx], multivariate[edge_idx + 1] });
+        }
+    }
+
+    /**
+     * @brief Extend each edge in the edge group to max-relation-length-many values.
+     */
+    void extend_edges(ExtendedEdges& extended_edges, const Edges& edges)
     {
-        for (auto [extended_edge, multivariate] : zip_view(extended_edges.get_all(), multivariates.get_all())) {
-            bb::Univariate<FF, 2> edge({ multivariate[edge_idx], multivariate[edge_idx + 1] });
+        for (auto [extended_edge, edge] : zip_view(extended_edges.get_all(), edges.get_all())) {
             extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
         }
     }
 
+    /**
+     * @brief Determine which relations can be skipped on an edge, i.e. which relations are gated by a selector that
+     * vanishes at both ends of the edge.
+     *
+     * @details A selector that vanishes at both ends of an edge vanishes on the whole extended edge, so this is checked
+     * on the edge values before any of them are extended.
+     */
+    template <size_t relation_idx = 0>
+    static void get_skipped_relations(std::array<bool, NUM_RELATIONS>& skipped_relations, const Edges& edges)
+    {
+        using Relation = std::tuple_element_t<relation_idx, Relations>;
+        if constexpr (bb::isSkippable<Relation, Edges>) {
+            skipped_relations[relation_idx] = Relation::skip(edges);
+        } else {
+            skipped_relations[relation_idx] = false;
+        }
+
+        // Repeat for the next relation.
+        if constexpr (relation_idx + 1 < NUM_RELATIONS) {
+            get_skipped_relations<relation_idx + 1>(skipped_relations, edges);
+        }
+    }
+
     /**
      * @brief Return the evaluations of the univariate restriction (S_l(X_l) in the thesis) at num_multivariates-many
      * values. Most likely this will end up being S_l(0), ... , S_l(t-1) where t is around 12. At the end, reset all
@@ -130,7 +165,8 @@ template <typename Flavor> class SumcheckProverRound {
             Utils::zero_univariates(accum);
         }
 
-        // Construct extended edge containers; one per thread
+        // Construct edge and extended edge containers; one per thread
+        std::vector<Edges> edges(num_threads);
         std::vector<ExtendedEdges> extended_edges;
         extended_edges.resize(num_threads);
 
@@ -138,14 +174,24 @@ template <typename Flavor> class SumcheckProverRound {
         parallel_for(num_threads, [&](size_t thread_idx) {
             size_t start = thread_idx * iterations_per_thread;
             size_t end = (thread_idx + 1) * iterations_per_thread;
+            std::array<bool, NUM_RELATIONS> skipped_relations{};
 
             for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
+                get_edges(edges[thread_idx], polynomials, edge_idx);
+
+                // Check the selectors before extending the edges, so that an edge on which every relation vanishes is
+                // not extended at all
+                get_skipped_relations(skipped_relations, edges[thread_idx]);
+                if (std::all_of(skipped_relations.begin(), skipped_relations.end(), [](bool skip) { return skip; })) {
+                    continue;
+                }
+                extend_edges(extended_edges[thread_idx], edges[thread_idx]);
 
                 // Compute the i-th edge's univariate contribution,
                 // scale it by pow_challenge constant contribution and add it to the accumulators for Sˡ(Xₗ)
                 accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
                                                 extended_edges[thread_idx],
+                                                skipped_relations,
                                                 relation_parameters,
                                                 pow_challenges[edge_idx >> 1]);
             }
@@ -232,21 +278,27 @@ template <typename Flavor> class SumcheckProverRound {
      * Result: for each relation, a univariate of some degree is computed by accumulating the contributions of each
      * group of edges. These are stored in `univariate_accumulators`. Adding these univariates together, with
      * appropriate scaling factors, produces S_l.
+     *
+     * Relations found to vanish on the edge by get_skipped_relations, e.g. in the padding of the circuit or in the
+     * blocks of other gate types, are skipped.
      */
     template <size_t relation_idx = 0>
     void accumulate_relation_univariates(SumcheckTupleOfTuplesOfUnivariates& univariate_accumulators,
                                          const auto& extended_edges,
+                                         const std::array<bool, NUM_RELATIONS>& skipped_relations,
                                          const bb::RelationParameters<FF>& relation_parameters,
                                          const FF& scaling_factor)
     {
         using Relation = std::tuple_element_t<relation_idx, Relations>;
-        Relation::accumulate(
-            std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        if (!skipped_relations[relation_idx]) {
+            Relation::accumulate(
+                std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        }
 
         // Repeat for the next relation.
         if constexpr (relation_idx + 1 < NUM_RELATIONS) {
             accumulate_relation_univariates<relation_idx + 1>(
-                univariate_accumulators, extended_edges, relation_parameters, scaling_factor);
+                univariate_accumulators, extended_edges, skipped_relations, relation_parameters, scaling_factor);
         }
     }
 };
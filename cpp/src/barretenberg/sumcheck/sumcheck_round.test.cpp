@@ -142,4 +142,57 @@ TEST(SumcheckRound, AddTuplesOfTuplesOfUnivariates)
     EXPECT_EQ(std::get<1>(std::get<1>(tuple_of_tuples_1)), expected_sum_3);
 }
 
+/**
+ * @brief Test that the relations gated by a selector are skipped exactly on the edges where the selector vanishes
+ *
+ */
+TEST(SumcheckRound, SkipRelationsWithVanishingSelector)
+{
+    using ExtendedEdges = typename Flavor::ExtendedEdges;
+    using ArithmeticRelation = bb::UltraArithmeticRelation<FF>;
+    using PermutationRelation = bb::UltraPermutationRelation<FF>;
+
+    static_assert(bb::isSkippable<ArithmeticRelation, ExtendedEdges>);
+    // The grand product relation contributes on every row, so it can never be skipped
+    static_assert(!bb::isSkippable<PermutationRelation, ExtendedEdges>);
+
+    ExtendedEdges extended_edges;
+    for (auto& edge : extended_edges.get_all()) {
+        edge = Univariate<FF, Flavor::MAX_PARTIAL_RELATION_LENGTH>(1);
+    }
+    extended_edges.q_arith = Univariate<FF, Flavor::MAX_PARTIAL_RELATION_LENGTH>(0);
+    EXPECT_TRUE(ArithmeticRelation::skip(extended_edges));
+
+    // An edge on which the selector is only zero at one end is not skipped
+    extended_edges.q_arith = Univariate<FF, 2>({ 0, 1 }).extend_to<Flavor::MAX_PARTIAL_RELATION_LENGTH>();
+    EXPECT_FALSE(ArithmeticRelation::skip(extended_edges));
+}
+
+/**
+ * @brief Test that the skipped relations are read off the edge values, before the edges are extended
+ *
+ */
+TEST(SumcheckRound, SkippedRelationsFromEdges)
+{
+    using SumcheckRound = SumcheckProverRound<Flavor>;
+    using Edges = typename SumcheckRound::Edges;
+
+    // Only the arithmetic selector vanishes on the whole edge, the auxiliary selector only at one end of it
+    Edges edges;
+    for (auto& edge : edges.get_all()) {
+        edge = Univariate<FF, 2>({ 1, 1 });
+    }
+    edges.q_arith = Univariate<FF, 2>({ 0, 0 });
+    edges.q_aux = Univariate<FF, 2>({ 1, 0 });
+
+    std::array<bool, Flavor::NUM_RELATIONS> skipped_relations{};
+    SumcheckRound::get_skipped_relations(skipped_relations, edges);
+    EXPECT_TRUE(skipped_relations[0]);  // UltraArithmeticRelation
+    EXPECT_FALSE(skipped_relations[1]); // UltraPermutationRelation, never skipped
+    EXPECT_FALSE(skipped_relations[2]); // LookupRelation, never skipped
+    EXPECT_FALSE(skipped_relations[3]); // GenPermSortRelation
+    EXPECT_FALSE(skipped_relations[4]); // EllipticRelation
+    EXPECT_FALSE(skipped_relations[5]); // AuxiliaryRelation
+}
+
 } // namespace test_sumcheck_round
@@ -46,12 +46,13 @@ ProverPolynomials construct_ultra_full_polynomials(auto& input_polynomials)
     return full_polynomials;
 }
 
+template <size_t NUM_INSTANCES = 2>
 std::shared_ptr<Instance> fold_and_verify(const std::vector<std::shared_ptr<Instance>>& instances,
                                           UltraComposer& composer,
                                           bool expected_result)
 {
-    auto folding_prover = composer.create_folding_prover(instances, composer.commitment_key);
-    auto folding_verifier = composer.create_folding_verifier();
+    auto folding_prover = composer.create_folding_prover<NUM_INSTANCES>(instances, composer.commitment_key);
+    auto folding_verifier = composer.create_folding_verifier<NUM_INSTANCES>();
 
     auto proof = folding_prover.fold_instances();
     auto next_accumulator = proof.accumulator;
@@ -137,6 +138,41 @@ TEST_F(ProtoGalaxyTests, PerturbatorCoefficients)
     }
 }
 
+// Check the perturbator against its definition, F(X) = ∑ᵢ fᵢ ∏ₗ (βₗ + δₗX)^{iₗ} with iₗ the bits of i, on an instance
+// large enough to be split over several threads
+TEST_F(ProtoGalaxyTests, PerturbatorCoefficientsLarge)
+{
+    const size_t log_instance_size(10);
+    const size_t instance_size(1 << log_instance_size);
+
+    std::vector<FF> betas(log_instance_size);
+    std::vector<FF> deltas(log_instance_size);
+    for (size_t idx = 0; idx < log_instance_size; idx++) {
+        betas[idx] = FF::random_element();
+        deltas[idx] = FF::random_element();
+    }
+    std::vector<FF> full_honk_evaluations(instance_size);
+    for (auto& eval : full_honk_evaluations) {
+        eval = FF::random_element();
+    }
+
+    auto perturbator = ProtoGalaxyProver::construct_perturbator_coefficients(betas, deltas, full_honk_evaluations);
+    EXPECT_EQ(perturbator.size(), log_instance_size + 1);
+
+    auto x = FF::random_element();
+    auto expected_evaluation = FF(0);
+    for (size_t i = 0; i < instance_size; i++) {
+        auto term = full_honk_evaluations[i];
+        for (size_t idx = 0; idx < log_instance_size; idx++) {
+            if (((i >> idx) & 1) == 1) {
+                term *= betas[idx] + deltas[idx] * x;
+            }
+        }
+        expected_evaluation += term;
+    }
+    EXPECT_EQ(Polynomial(perturbator).evaluate(x), expected_evaluation);
+}
+
 TEST_F(ProtoGalaxyTests, PerturbatorPolynomial)
 {
     using RelationSeparator = Flavor::RelationSeparator;
@@ -286,6 +322,56 @@ TEST_F(ProtoGalaxyTests, FullProtogalaxyTest)
     decide_and_verify(second_accumulator, composer, true);
 }
 
+// Check the Lagrange basis and vanishing polynomial of the instance domain against their closed forms for 2 instances
+TEST_F(ProtoGalaxyTests, LagrangeBasisAndVanishingPolynomial)
+{
+    auto challenge = FF::random_element();
+    auto [lagranges, vanishing_polynomial] = compute_lagrange_basis_and_vanishing_polynomial<2>(challenge);
+    EXPECT_EQ(lagranges[0], FF(1) - challenge);
+    EXPECT_EQ(lagranges[1], challenge);
+    EXPECT_EQ(vanishing_polynomial, challenge * (challenge - FF(1)));
+
+    // The Lagrange basis of any domain sums to 1
+    auto [lagranges_8, vanishing_polynomial_8] = compute_lagrange_basis_and_vanishing_polynomial<8>(challenge);
+    FF sum = 0;
+    FF expected_vanishing_polynomial = 1;
+    for (size_t idx = 0; idx < 8; idx++) {
+        sum += lagranges_8[idx];
+        expected_vanishing_polynomial *= challenge - FF(idx);
+    }
+    EXPECT_EQ(sum, FF(1));
+    EXPECT_EQ(vanishing_polynomial_8, expected_vanishing_polynomial);
+}
+
+// Fold several instances at once, starting from a fresh instance and then into the resulting accumulator
+TEST_F(ProtoGalaxyTests, FullProtogalaxyTestMultipleInstances)
+{
+    constexpr size_t NUM_INSTANCES = 4;
+    auto composer = UltraComposer();
+
+    const auto construct_instance = [&]() {
+        auto builder = typename Flavor::CircuitBuilder();
+        builder.add_public_variable(FF(1));
+        return composer.create_instance(builder);
+    };
+
+    std::vector<std::shared_ptr<Instance>> instances;
+    for (size_t idx = 0; idx < NUM_INSTANCES; idx++) {
+        instances.emplace_back(construct_instance());
+    }
+    auto first_accumulator = fold_and_verify<NUM_INSTANCES>(instances, composer, true);
+    check_accumulator_target_sum_manual(first_accumulator, true);
+
+    instances = std::vector<std::shared_ptr<Instance>>{ first_accumulator };
+    for (size_t idx = 1; idx < NUM_INSTANCES; idx++) {
+        instances.emplace_back(construct_instance());
+    }
+    auto second_accumulator = fold_and_verify<NUM_INSTANCES>(instances, composer, true);
+    check_accumulator_target_sum_manual(second_accumulator, true);
+
+    decide_and_verify(second_accumulator, composer, true);
+}
+
 TEST_F(ProtoGalaxyTests, TamperedCommitment)
 {
     auto composer = UltraComposer();
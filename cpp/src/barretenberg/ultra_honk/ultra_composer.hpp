@@ -40,6 +40,13 @@ template <UltraFlavor Flavor> class UltraComposer_ {
     std::shared_ptr<CRSFactory> crs_factory_;
     // The commitment key is passed to the prover but also used herein to compute the verfication key commitments
     std::shared_ptr<CommitmentKey> commitment_key;
+    // Commit with fixed-base MSMs over precomputed multiples of the SRS (see CommitmentKey::enable_fixed_base_msm).
+    // The multiples are built once per SRS and take up to fixed_base_msm_max_table_bytes, so this is opt in.
+    bool use_fixed_base_msm = false;
+    size_t fixed_base_msm_max_table_bytes =
+        bb::scalar_multiplication::fixed_base_point_table<typename Flavor::Curve>::DEFAULT_MAX_TABLE_BYTES;
+    // Passed on to the provers created here, see UltraProver_::num_streamed_sumcheck_rounds. 1 is the regular mode.
+    size_t num_streamed_sumcheck_rounds = 1;
 
     UltraComposer_() { crs_factory_ = bb::srs::get_crs_factory(); }
 
@@ -56,10 +63,20 @@ template <UltraFlavor Flavor> class UltraComposer_ {
     std::shared_ptr<CommitmentKey> compute_commitment_key(size_t circuit_size)
     {
         commitment_key = std::make_shared<CommitmentKey>(circuit_size + 1);
+        if (use_fixed_base_msm) {
+            commitment_key->enable_fixed_base_msm(fixed_base_msm_max_table_bytes);
+        }
         return commitment_key;
     };
 
     std::shared_ptr<Instance> create_instance(CircuitBuilder& circuit);
+    /**
+     * @brief Create an instance reusing the precomputed polynomials of a proving key computed for the same circuit
+     * @details If the verification key of the circuit is given its commitments are not recomputed either.
+     */
+    std::shared_ptr<Instance> create_instance(CircuitBuilder& circuit,
+                                              const std::shared_ptr<ProvingKey>& precomputed_key,
+                                              const std::shared_ptr<VerificationKey>& verification_key = nullptr);
 
     UltraProver_<Flavor> create_prover(const std::shared_ptr<Instance>&,
                                        const std::shared_ptr<Transcript>& transcript = std::make_shared<Transcript>());
@@ -110,18 +127,23 @@ template <UltraFlavor Flavor> class UltraComposer_ {
      */
     MergeVerifier_<Flavor> create_merge_verifier() { return MergeVerifier_<Flavor>(); }
 
-    ProtoGalaxyProver_<ProverInstances> create_folding_prover(const std::vector<std::shared_ptr<Instance>>& instances,
-                                                              const std::shared_ptr<CommitmentKey>& commitment_key)
+    /**
+     * @brief Create a prover that folds NUM_INSTANCES instances in one round, the first of which is the accumulator.
+     */
+    template <size_t NUM_INSTANCES = NUM_FOLDING>
+    ProtoGalaxyProver_<ProverInstances_<Flavor, NUM_INSTANCES>> create_folding_prover(
+        const std::vector<std::shared_ptr<Instance>>& instances, const std::shared_ptr<CommitmentKey>& commitment_key)
     {
-        ProtoGalaxyProver_<ProverInstances> output_state(instances, commitment_key);
+        ProtoGalaxyProver_<ProverInstances_<Flavor, NUM_INSTANCES>> output_state(instances, commitment_key);
 
         return output_state;
     };
-    ProtoGalaxyVerifier_<VerifierInstances> create_folding_verifier()
+    template <size_t NUM_INSTANCES = NUM_FOLDING>
+    ProtoGalaxyVerifier_<VerifierInstances_<Flavor, NUM_INSTANCES>> create_folding_verifier()
     {
 
-        auto insts = VerifierInstances();
-        ProtoGalaxyVerifier_<VerifierInstances> output_state(insts);
+        auto insts = VerifierInstances_<Flavor, NUM_INSTANCES>();
+        ProtoGalaxyVerifier_<VerifierInstances_<Flavor, NUM_INSTANCES>> output_state(insts);
 
         return output_state;
     };
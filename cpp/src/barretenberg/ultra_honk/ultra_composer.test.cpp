@@ -1,6 +1,7 @@
 #include "barretenberg/ultra_honk/ultra_composer.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/flavor/mmap_proving_key.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/proof_system/circuit_builder/ultra_circuit_builder.hpp"
 #include "barretenberg/proof_system/library/grand_product_delta.hpp"
@@ -12,6 +13,7 @@
 #include "barretenberg/ultra_honk/ultra_prover.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <gtest/gtest.h>
 #include <string>
 #include <vector>
@@ -117,6 +119,173 @@ TEST_F(UltraHonkComposerTests, PublicInputs)
     prove_and_verify(builder, composer, /*expected_result=*/true);
 }
 
+/**
+ * @brief Test that a composer committing with fixed-base MSMs produces the same verification key and proof as the
+ * regular pippenger
+ *
+ */
+TEST_F(UltraHonkComposerTests, FixedBaseMsm)
+{
+    auto construct_circuit = []() {
+        auto builder = bb::UltraCircuitBuilder();
+        for (size_t i = 0; i < 16; ++i) {
+            fr a = fr(i + 2);
+            fr b = fr(i * i + 3);
+            uint32_t a_idx = builder.add_public_variable(a);
+            uint32_t b_idx = builder.add_variable(b);
+            uint32_t c_idx = builder.add_variable(a * b);
+            builder.create_mul_gate({ a_idx, b_idx, c_idx, fr(1), fr(-1), fr(0) });
+        }
+        return builder;
+    };
+
+    auto builder = construct_circuit();
+    auto composer = UltraComposer();
+    auto instance = composer.create_instance(builder);
+    auto proof = composer.create_prover(instance).construct_proof();
+
+    auto fixed_base_builder = construct_circuit();
+    auto fixed_base_composer = UltraComposer();
+    fixed_base_composer.use_fixed_base_msm = true;
+    auto fixed_base_instance = fixed_base_composer.create_instance(fixed_base_builder);
+    EXPECT_NE(fixed_base_composer.commitment_key->fixed_base_point_table, nullptr);
+    auto fixed_base_prover = fixed_base_composer.create_prover(fixed_base_instance);
+    auto fixed_base_proof = fixed_base_prover.construct_proof();
+
+    for (auto [commitment, fixed_base_commitment] :
+         zip_view(instance->verification_key->get_all(), fixed_base_instance->verification_key->get_all())) {
+        EXPECT_EQ(commitment, fixed_base_commitment);
+    }
+    EXPECT_EQ(proof.proof_data, fixed_base_proof.proof_data);
+
+    auto verifier = fixed_base_composer.create_verifier(fixed_base_instance);
+    EXPECT_TRUE(verifier.verify_proof(fixed_base_proof));
+}
+
+/**
+ * @brief Test that the low-memory sumcheck mode of the prover produces the same proof as the regular mode
+ *
+ */
+TEST_F(UltraHonkComposerTests, LowMemorySumcheck)
+{
+    auto construct_circuit = []() {
+        auto builder = bb::UltraCircuitBuilder();
+        for (size_t i = 0; i < 64; ++i) {
+            fr a = fr(i + 2);
+            fr b = fr(i * i + 3);
+            uint32_t a_idx = builder.add_variable(a);
+            uint32_t b_idx = builder.add_variable(b);
+            uint32_t c_idx = builder.add_variable(a * b);
+            builder.create_mul_gate({ a_idx, b_idx, c_idx, fr(1), fr(-1), fr(0) });
+        }
+        return builder;
+    };
+
+    auto builder = construct_circuit();
+    auto composer = UltraComposer();
+    auto instance = composer.create_instance(builder);
+    auto proof = composer.create_prover(instance).construct_proof();
+
+    auto low_memory_builder = construct_circuit();
+    auto low_memory_composer = UltraComposer();
+    low_memory_composer.num_streamed_sumcheck_rounds = 3;
+    auto low_memory_instance = low_memory_composer.create_instance(low_memory_builder);
+    auto low_memory_prover = low_memory_composer.create_prover(low_memory_instance);
+    EXPECT_EQ(low_memory_prover.num_streamed_sumcheck_rounds, 3UL);
+    auto low_memory_proof = low_memory_prover.construct_proof();
+
+    EXPECT_EQ(proof.proof_data, low_memory_proof.proof_data);
+    auto verifier = low_memory_composer.create_verifier(low_memory_instance);
+    EXPECT_TRUE(verifier.verify_proof(low_memory_proof));
+}
+
+#ifndef __wasm__
+/**
+ * @brief Test that the precomputed polynomials of a circuit can be written once, mapped back and reused to prove the
+ * same circuit with different witnesses
+ *
+ */
+TEST_F(UltraHonkComposerTests, MemoryMappedProvingKey)
+{
+    auto construct_circuit = []() {
+        auto builder = bb::UltraCircuitBuilder();
+        for (size_t i = 0; i < 10; ++i) {
+            fr a = fr::random_element();
+            fr b = fr::random_element();
+            uint32_t a_idx = builder.add_public_variable(a);
+            uint32_t b_idx = builder.add_variable(b);
+            uint32_t c_idx = builder.add_variable(a * b);
+            builder.create_mul_gate({ a_idx, b_idx, c_idx, fr(1), fr(-1), fr(0) });
+        }
+        return builder;
+    };
+
+    auto builder = construct_circuit();
+    auto composer = UltraComposer();
+    auto instance = composer.create_instance(builder);
+    const std::string pk_path =
+        (std::filesystem::temp_directory_path() / "ultra_honk_memory_mapped_proving_key").string();
+    flavor::write_mmap_proving_key<flavor::Ultra>(pk_path, *instance->proving_key);
+    auto precomputed_key = flavor::read_mmap_proving_key<flavor::Ultra>(pk_path);
+    std::filesystem::remove(pk_path);
+
+    for (auto [poly, mapped_poly] : zip_view(instance->proving_key->get_precomputed_polynomials(),
+                                             precomputed_key->get_precomputed_polynomials())) {
+        EXPECT_EQ(poly, mapped_poly);
+    }
+
+    // The key serves several proofs of the circuit, each with its own witness
+    for (size_t i = 0; i < 2; ++i) {
+        auto new_builder = construct_circuit();
+        auto new_composer = UltraComposer();
+        auto new_instance = new_composer.create_instance(new_builder, precomputed_key, instance->verification_key);
+        auto prover = new_composer.create_prover(new_instance);
+        auto verifier = new_composer.create_verifier(new_instance);
+        auto proof = prover.construct_proof();
+        EXPECT_TRUE(verifier.verify_proof(proof));
+    }
+}
+#endif
+
+TEST_F(UltraHonkComposerTests, VerifyBatch)
+{
+    auto construct_circuit = []() {
+        auto builder = bb::UltraCircuitBuilder();
+        for (size_t i = 0; i < 10; ++i) {
+            fr a = fr::random_element();
+            fr b = fr::random_element();
+            uint32_t a_idx = builder.add_public_variable(a);
+            uint32_t b_idx = builder.add_variable(b);
+            uint32_t c_idx = builder.add_variable(a * b);
+            builder.create_mul_gate({ a_idx, b_idx, c_idx, fr(1), fr(-1), fr(0) });
+        }
+        return builder;
+    };
+
+    // Proofs of a circuit with different witnesses, all verified against the key of the first one
+    auto builder = construct_circuit();
+    auto composer = UltraComposer();
+    auto instance = composer.create_instance(builder);
+    auto verifier = composer.create_verifier(instance);
+    std::vector<plonk::proof> proofs{ composer.create_prover(instance).construct_proof() };
+    for (size_t i = 1; i < 4; ++i) {
+        auto new_builder = construct_circuit();
+        auto new_composer = UltraComposer();
+        auto new_instance = new_composer.create_instance(new_builder);
+        proofs.emplace_back(new_composer.create_prover(new_instance).construct_proof());
+    }
+    EXPECT_TRUE(verifier.verify_batch(proofs));
+    for (const auto& proof : proofs) {
+        EXPECT_TRUE(verifier.verify_proof(proof));
+    }
+
+    // Replace the final opening commitment of a proof, which only the pairing check catches
+    const auto generator = to_buffer(g1::affine_one);
+    std::copy(generator.begin(), generator.end(), proofs[2].proof_data.end() - static_cast<long>(generator.size()));
+    EXPECT_FALSE(verifier.verify_proof(proofs[2]));
+    EXPECT_FALSE(verifier.verify_batch(proofs));
+}
+
 TEST_F(UltraHonkComposerTests, XorConstraint)
 {
     auto circuit_builder = bb::UltraCircuitBuilder();
@@ -1,4 +1,5 @@
 #include "ultra_prover.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/sumcheck/sumcheck.hpp"
 
 namespace bb::honk {
@@ -53,9 +54,11 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_wire_commitment
 
     // Commit to the first three wire polynomials
     // We only commit to the fourth wire polynomial after adding memory recordss
-    witness_commitments.w_l = commitment_key->commit(proving_key->w_l);
-    witness_commitments.w_r = commitment_key->commit(proving_key->w_r);
-    witness_commitments.w_o = commitment_key->commit(proving_key->w_o);
+    const std::array<std::span<const FF>, 3> wire_polys{ proving_key->w_l, proving_key->w_r, proving_key->w_o };
+    const auto wire_commitments = commitment_key->commit_batch(wire_polys);
+    witness_commitments.w_l = wire_commitments[0];
+    witness_commitments.w_r = wire_commitments[1];
+    witness_commitments.w_o = wire_commitments[2];
 
     auto wire_comms = witness_commitments.get_wires();
     auto labels = commitment_labels.get_wires();
@@ -64,11 +67,14 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_wire_commitment
     }
 
     if constexpr (IsGoblinFlavor<Flavor>) {
-        // Commit to Goblin ECC op wires
-        witness_commitments.ecc_op_wire_1 = commitment_key->commit(proving_key->ecc_op_wire_1);
-        witness_commitments.ecc_op_wire_2 = commitment_key->commit(proving_key->ecc_op_wire_2);
-        witness_commitments.ecc_op_wire_3 = commitment_key->commit(proving_key->ecc_op_wire_3);
-        witness_commitments.ecc_op_wire_4 = commitment_key->commit(proving_key->ecc_op_wire_4);
+        // Commit to Goblin ECC op wires and DataBus columns. These are only populated in the first few rows of the
+        // circuit, so we skip their zero coefficients.
+        witness_commitments.ecc_op_wire_1 = commitment_key->commit_sparse(proving_key->ecc_op_wire_1);
+        witness_commitments.ecc_op_wire_2 = commitment_key->commit_sparse(proving_key->ecc_op_wire_2);
+        witness_commitments.ecc_op_wire_3 = commitment_key->commit_sparse(proving_key->ecc_op_wire_3);
+        witness_commitments.ecc_op_wire_4 = commitment_key->commit_sparse(proving_key->ecc_op_wire_4);
+        witness_commitments.calldata = commitment_key->commit_sparse(proving_key->calldata);
+        witness_commitments.calldata_read_counts = commitment_key->commit_sparse(proving_key->calldata_read_counts);
 
         auto op_wire_comms = instance->witness_commitments.get_ecc_op_wires();
         auto labels = commitment_labels.get_ecc_op_wires();
@@ -76,9 +82,6 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_wire_commitment
             transcript->send_to_verifier(labels[idx], op_wire_comms[idx]);
         }
 
-        // Commit to DataBus columns
-        witness_commitments.calldata = commitment_key->commit(proving_key->calldata);
-        witness_commitments.calldata_read_counts = commitment_key->commit(proving_key->calldata_read_counts);
         transcript->send_to_verifier(commitment_labels.calldata, instance->witness_commitments.calldata);
         transcript->send_to_verifier(commitment_labels.calldata_read_counts,
                                      instance->witness_commitments.calldata_read_counts);
@@ -98,8 +101,11 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_sorted_list_acc
     auto& witness_commitments = instance->witness_commitments;
     // Commit to the sorted withness-table accumulator and the finalized (i.e. with memory records) fourth wire
     // polynomial
-    witness_commitments.sorted_accum = commitment_key->commit(instance->prover_polynomials.sorted_accum);
-    witness_commitments.w_4 = commitment_key->commit(instance->prover_polynomials.w_4);
+    const std::array<std::span<const FF>, 2> polys{ instance->prover_polynomials.sorted_accum,
+                                                    instance->prover_polynomials.w_4 };
+    const auto commitments = commitment_key->commit_batch(polys);
+    witness_commitments.sorted_accum = commitments[0];
+    witness_commitments.w_4 = commitments[1];
 
     transcript->send_to_verifier(commitment_labels.sorted_accum, instance->witness_commitments.sorted_accum);
     transcript->send_to_verifier(commitment_labels.w_4, instance->witness_commitments.w_4);
@@ -108,6 +114,10 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_sorted_list_acc
 /**
  * @brief Compute log derivative inverse polynomial and its commitment, if required
  *
+ * @details The grand product polynomials depend on the same challenges as the log derivative inverse, so in the Goblin
+ * Flavor we start computing them in the background here and commit to the inverse in the meantime. The pipelined
+ * computation never runs an MSM, so the commitment key (and its pippenger runtime state) is only ever used by one
+ * thread at a time.
  */
 template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_log_derivative_inverse_round()
 {
@@ -118,6 +128,11 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_log_derivative_
 
     if constexpr (IsGoblinFlavor<Flavor>) {
         instance->compute_logderivative_inverse(beta, gamma);
+        // The task owns a reference to the instance rather than the prover, so it stays valid if the prover is
+        // destroyed (e.g. by an exception) before the grand product round joins it.
+        grand_product_computation = spawn_task([instance = instance, beta, gamma]() {
+            instance->compute_grand_product_polynomials(beta, gamma);
+        });
         instance->witness_commitments.lookup_inverses =
             commitment_key->commit(instance->prover_polynomials.lookup_inverses);
         transcript->send_to_verifier(commitment_labels.lookup_inverses, instance->witness_commitments.lookup_inverses);
@@ -130,12 +145,19 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_log_derivative_
  */
 template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_grand_product_computation_round()
 {
-
-    instance->compute_grand_product_polynomials(relation_parameters.beta, relation_parameters.gamma);
+    // The grand products may already be in progress, see execute_log_derivative_inverse_round
+    if (grand_product_computation.valid()) {
+        wait_for_task(grand_product_computation);
+    } else {
+        instance->compute_grand_product_polynomials(relation_parameters.beta, relation_parameters.gamma);
+    }
 
     auto& witness_commitments = instance->witness_commitments;
-    witness_commitments.z_perm = commitment_key->commit(instance->prover_polynomials.z_perm);
-    witness_commitments.z_lookup = commitment_key->commit(instance->prover_polynomials.z_lookup);
+    const std::array<std::span<const FF>, 2> polys{ instance->prover_polynomials.z_perm,
+                                                    instance->prover_polynomials.z_lookup };
+    const auto commitments = commitment_key->commit_batch(polys);
+    witness_commitments.z_perm = commitments[0];
+    witness_commitments.z_lookup = commitments[1];
     transcript->send_to_verifier(commitment_labels.z_perm, instance->witness_commitments.z_perm);
     transcript->send_to_verifier(commitment_labels.z_lookup, instance->witness_commitments.z_lookup);
 }
@@ -148,7 +170,7 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_relation_check_
 {
     using Sumcheck = sumcheck::SumcheckProver<Flavor>;
     auto circuit_size = instance->proving_key->circuit_size;
-    auto sumcheck = Sumcheck(circuit_size, transcript);
+    auto sumcheck = Sumcheck(circuit_size, transcript, num_streamed_sumcheck_rounds);
     RelationSeparator alphas;
     for (size_t idx = 0; idx < alphas.size(); idx++) {
         alphas[idx] = transcript->get_challenge("Sumcheck:alpha_" + std::to_string(idx));
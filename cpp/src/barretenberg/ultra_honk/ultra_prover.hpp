@@ -8,6 +8,8 @@
 #include "barretenberg/sumcheck/sumcheck_output.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 
+#include <future>
+
 namespace bb::honk {
 
 template <UltraFlavor Flavor> class UltraProver_ {
@@ -52,10 +54,17 @@ template <UltraFlavor Flavor> class UltraProver_ {
 
     std::shared_ptr<CommitmentKey> commitment_key;
 
+    // The number of sumcheck rounds computed straight from the full polynomials, see sumcheck::SumcheckProver. More
+    // than one selects the low-memory mode, which shrinks the partially evaluated polynomials to n / 2^k.
+    size_t num_streamed_sumcheck_rounds = 1;
+
     using ZeroMorph = pcs::zeromorph::ZeroMorphProver_<Curve>;
 
   private:
     plonk::proof proof;
+
+    // Background computation of the grand product polynomials, started once beta and gamma are known
+    std::future<void> grand_product_computation;
 };
 
 using UltraProver = UltraProver_<honk::flavor::Ultra>;
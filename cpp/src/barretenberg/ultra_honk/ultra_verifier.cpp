@@ -1,5 +1,6 @@
 #include "./ultra_verifier.hpp"
 #include "barretenberg/commitment_schemes/zeromorph/zeromorph.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 
@@ -46,6 +47,57 @@ template <typename Flavor> UltraVerifier_<Flavor>& UltraVerifier_<Flavor>::opera
  *
  */
 template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk::proof& proof)
+{
+    auto pairing_points = compute_pairing_points(proof);
+    if (!pairing_points.has_value()) {
+        return false;
+    }
+    return pcs_verification_key->pairing_check((*pairing_points)[0], (*pairing_points)[1]);
+}
+
+template <typename Flavor> bool UltraVerifier_<Flavor>::verify_batch(const std::vector<plonk::proof>& proofs)
+{
+    using Curve = typename Flavor::Curve;
+
+    if (proofs.empty()) {
+        return true;
+    }
+
+    const size_t num_proofs = proofs.size();
+    // Both MSMs write the pippenger point table of their points in place, hence the doubled size
+    std::vector<Commitment> P_0_points(num_proofs * 2);
+    std::vector<Commitment> P_1_points(num_proofs * 2);
+    std::vector<FF> weights(num_proofs);
+    for (size_t j = 0; j < num_proofs; ++j) {
+        auto pairing_points = compute_pairing_points(proofs[j]);
+        if (!pairing_points.has_value()) {
+            return false;
+        }
+        P_0_points[j] = (*pairing_points)[0];
+        P_1_points[j] = (*pairing_points)[1];
+        // A random combination of the pairing checks holds if and only if each of them does, except with negligible
+        // probability. The weights are only drawn once the proofs are fixed, and the first one can be one.
+        weights[j] = j == 0 ? FF::one() : FF::random_element();
+    }
+
+    bb::scalar_multiplication::pippenger_runtime_state<Curve> state(num_proofs);
+    const auto msm = [&](std::vector<Commitment>& points) {
+        bb::scalar_multiplication::generate_pippenger_point_table<Curve>(&points[0], &points[0], num_proofs);
+        return bb::scalar_multiplication::pippenger<Curve>(&weights[0], &points[0], num_proofs, state);
+    };
+    const auto P_0 = msm(P_0_points);
+    const auto P_1 = msm(P_1_points);
+    return pcs_verification_key->pairing_check(P_0, P_1);
+}
+
+/**
+ * @brief Runs the verifier up to the final pairing check, returning its inputs
+ *
+ * @return std::nullopt if the proof was already rejected
+ */
+template <typename Flavor>
+std::optional<std::array<typename Flavor::Commitment, 2>> UltraVerifier_<Flavor>::compute_pairing_points(
+    const plonk::proof& proof)
 {
     using FF = typename Flavor::FF;
     using Commitment = typename Flavor::Commitment;
@@ -67,10 +119,10 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk
     const auto pub_inputs_offset = transcript->template receive_from_prover<uint32_t>("pub_inputs_offset");
 
     if (circuit_size != key->circuit_size) {
-        return false;
+        return std::nullopt;
     }
     if (public_input_size != key->num_public_inputs) {
-        return false;
+        return std::nullopt;
     }
 
     std::vector<FF> public_inputs;
@@ -146,7 +198,7 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk
 
     // If Sumcheck did not verify, return false
     if (sumcheck_verified.has_value() && !sumcheck_verified.value()) {
-        return false;
+        return std::nullopt;
     }
 
     // Execute ZeroMorph rounds. See https://hackmd.io/dlf9xEwhTQyE3hiGbq4FsA?view for a complete description of the
@@ -158,9 +210,10 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk
                                             multivariate_challenge,
                                             transcript);
 
-    auto verified = pcs_verification_key->pairing_check(pairing_points[0], pairing_points[1]);
-
-    return sumcheck_verified.value() && verified;
+    if (!sumcheck_verified.value()) {
+        return std::nullopt;
+    }
+    return pairing_points;
 }
 
 template class UltraVerifier_<honk::flavor::Ultra>;
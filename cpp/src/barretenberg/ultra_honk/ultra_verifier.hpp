@@ -4,6 +4,7 @@
 #include "barretenberg/plonk/proof_system/types/proof.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 #include "barretenberg/sumcheck/sumcheck.hpp"
+#include <optional>
 
 namespace bb::honk {
 template <typename Flavor> class UltraVerifier_ {
@@ -26,10 +27,22 @@ template <typename Flavor> class UltraVerifier_ {
 
     bool verify_proof(const plonk::proof& proof);
 
+    /**
+     * @brief Verifies proofs of the circuit of this verifier with a single pairing check
+     *
+     * @details The pairing points of each proof are weighted by a random scalar and summed by two MSMs, so that all
+     * proofs are checked by one two-pairing final check. Returns true iff every proof verifies, except with negligible
+     * probability.
+     */
+    bool verify_batch(const std::vector<plonk::proof>& proofs);
+
     std::shared_ptr<VerificationKey> key;
     std::map<std::string, Commitment> commitments;
     std::shared_ptr<VerifierCommitmentKey> pcs_verification_key;
     std::shared_ptr<Transcript> transcript;
+
+  private:
+    std::optional<std::array<Commitment, 2>> compute_pairing_points(const plonk::proof& proof);
 };
 
 using UltraVerifier = UltraVerifier_<honk::flavor::Ultra>;